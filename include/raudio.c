@@ -184,6 +184,28 @@ typedef struct tagBITMAPINFOHEADER {
 #include <stdio.h>                      // Required for: FILE, fopen(), fclose(), fread()
 #include <string.h>                     // Required for: strcmp() [Used in IsFileExtension(), LoadWaveFromMemory(), LoadMusicStreamFromMemory()]
 
+#if !defined(_WIN32)
+    #include <sys/mman.h>               // Required for: mmap(), munmap() [Used in LoadSoundBank(), UnloadSoundBank()]
+    #include <sys/stat.h>               // Required for: fstat()
+    #include <fcntl.h>                  // Required for: open()
+    #include <unistd.h>                 // Required for: close()
+#endif
+
+// SIMD mixing kernels, selected at runtime on x86 and always on for ARM64
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define RAUDIO_MIXER_X86
+    #include <immintrin.h>              // Required for: SSE2, AVX2 and FMA intrinsics
+    #if defined(_MSC_VER)
+        #include <intrin.h>             // Required for: __cpuid(), __cpuidex(), _xgetbv()
+        #define RAUDIO_TARGET_AVX2
+    #else
+        #define RAUDIO_TARGET_AVX2 __attribute__((target("avx2,fma")))
+    #endif
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+    #define RAUDIO_MIXER_NEON
+    #include <arm_neon.h>               // Required for: NEON intrinsics
+#endif
+
 #if defined(RAUDIO_STANDALONE)
     #ifndef TRACELOG
         #define TRACELOG(level, ...)    printf(__VA_ARGS__)
@@ -298,6 +320,12 @@ typedef struct tagBITMAPINFOHEADER {
 #ifndef MAX_AUDIO_BUFFER_POOL_CHANNELS
     #define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Audio pool channels
 #endif
+#ifndef SOUND_BANK_ALIGNMENT
+    #define SOUND_BANK_ALIGNMENT              64    // Sound bank data alignment, keeps SIMD loads on cache lines
+#endif
+#ifndef AUDIO_COMMAND_QUEUE_SIZE
+    #define AUDIO_COMMAND_QUEUE_SIZE         256    // Pending play/stop/param commands, must be a power of 2
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -349,8 +377,8 @@ struct rAudioBuffer {
     float pitch;                    // Audio buffer pitch
     float pan;                      // Audio buffer pan (0.0f to 1.0f)
 
-    bool playing;                   // Audio buffer state: AUDIO_PLAYING
-    bool paused;                    // Audio buffer state: AUDIO_PAUSED
+    ma_bool32 playing;              // Audio buffer state: AUDIO_PLAYING, only written by the mixer, read atomically
+    ma_bool32 paused;               // Audio buffer state: AUDIO_PAUSED, only written by the mixer, read atomically
     bool looping;                   // Audio buffer looping, default to true for AudioStreams
     int usage;                      // Audio buffer usage mode: STATIC or STREAM
 
@@ -363,6 +391,14 @@ struct rAudioBuffer {
 
     rAudioBuffer *next;             // Next audio buffer on the list
     rAudioBuffer *prev;             // Previous audio buffer on the list
+
+    bool pendingPlaying;            // Game thread view of playing, once the queued commands are applied
+    bool pendingPaused;             // Game thread view of paused, once the queued commands are applied
+    ma_uint32 pendingUntil;         // Command queue position just past its last queued play/stop/pause/resume
+
+    rAudioBuffer *nextRetired;      // Next unloaded buffer waiting for the mixer to let go of it
+    ma_uint32 retiredAt;            // Command queue position just past its untrack command
+    bool freeData;                  // Free data along with the buffer, aliases share it with their source
 };
 
 // Audio processor struct
@@ -375,12 +411,55 @@ struct rAudioProcessor {
 
 #define AudioBuffer rAudioBuffer    // HACK: To avoid CoreAudio (macOS) symbol collision
 
+// Audio command type
+// NOTE: Commands are posted by the game thread and applied by the mixer
+typedef enum {
+    AUDIO_COMMAND_PLAY = 0,         // Restart buffer from the start
+    AUDIO_COMMAND_STOP,
+    AUDIO_COMMAND_PAUSE,
+    AUDIO_COMMAND_RESUME,           // Last command changing playing/paused, see PostAudioCommand()
+    AUDIO_COMMAND_VOLUME,
+    AUDIO_COMMAND_PITCH,
+    AUDIO_COMMAND_PAN,
+    AUDIO_COMMAND_TRACK,            // Link buffer into the mixing list
+    AUDIO_COMMAND_UNTRACK           // Unlink buffer from the mixing list
+} AudioCommandType;
+
+// Audio command struct
+typedef struct AudioCommand {
+    int type;                       // Command type: AudioCommandType
+    AudioBuffer *buffer;            // Target audio buffer
+    float value;                    // Volume, pitch or pan, unused by the others
+} AudioCommand;
+
+// Mixing kernel, accumulates samplesIn*gain into samplesOut
+// NOTE: Even and odd samples get separate gains, that is left/right for interleaved stereo
+typedef void (*MixSamplesFunc)(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, float gainEven, float gainOdd);
+
+// Sound bank file header
+// NOTE: Sound data follows the entries, each sound aligned to SOUND_BANK_ALIGNMENT bytes
+typedef struct SoundBankHeader {
+    char id[4];                     // Sound bank file identifier: "rSBK"
+    unsigned int version;           // Sound bank file version: 1
+    unsigned int format;            // Sample format (ma_format), must match AUDIO_DEVICE_FORMAT
+    unsigned int channels;          // Channels, must match AUDIO_DEVICE_CHANNELS
+    unsigned int sampleRate;        // Sample rate, must match the device sample rate
+    unsigned int soundCount;        // Number of SoundBankEntry following the header
+} SoundBankHeader;
+
+// Sound bank file index entry
+typedef struct SoundBankEntry {
+    char name[32];                  // Sound name, '\0' terminated
+    unsigned int offset;            // Sound data offset from the start of the file
+    unsigned int frameCount;        // Sound data length in frames
+} SoundBankEntry;
+
 // Audio data context
 typedef struct AudioData {
     struct {
         ma_context context;         // miniaudio context data
         ma_device device;           // miniaudio device
-        ma_mutex lock;              // miniaudio mutex lock
+        ma_spinlock lock;           // Taken by the game thread, the mixer only tries it and skips a period if it is busy
         bool isReady;               // Check if audio device is ready
         size_t pcmBufferSize;       // Pre-allocated buffer size
         void *pcmBuffer;            // Pre-allocated buffer to read audio data from file/memory
@@ -388,8 +467,18 @@ typedef struct AudioData {
     struct {
         AudioBuffer *first;         // Pointer to first AudioBuffer in the list
         AudioBuffer *last;          // Pointer to last AudioBuffer in the list
+        AudioBuffer *retired;       // Unloaded buffers, freed once the mixer has applied their untrack command
         int defaultSize;            // Default audio buffer size for audio streams
     } Buffer;
+    struct {
+        AudioCommand ring[AUDIO_COMMAND_QUEUE_SIZE];    // Single producer/single consumer ring
+        ma_uint32 head;             // Commands posted, only written by the game thread
+        ma_uint32 tail;             // Commands applied, only written by the mixer (or the game thread with no device)
+    } Command;
+    struct {
+        MixSamplesFunc mix;         // Mixing kernel picked by the CPU features, see SelectMixer()
+        const char *name;           // Mixing kernel name, for logging
+    } Mixer;
     rAudioProcessor *mixedProcessor;
 } AudioData;
 
@@ -418,10 +507,31 @@ static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, f
 static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const void *pFramesInput, ma_uint32 frameCount);
 static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer);
 
+static void SelectMixer(void);
+static void MixSamplesScalar(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, float gainEven, float gainOdd);
+#if defined(RAUDIO_MIXER_X86)
+static void MixSamplesSSE2(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, float gainEven, float gainOdd);
+static void MixSamplesAVX2(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, float gainEven, float gainOdd);
+#endif
+#if defined(RAUDIO_MIXER_NEON)
+static void MixSamplesNEON(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, float gainEven, float gainOdd);
+#endif
+
 static bool IsAudioBufferPlayingInLockedState(AudioBuffer *buffer);
 static void StopAudioBufferInLockedState(AudioBuffer *buffer);
 static void UpdateAudioStreamInLockedState(AudioStream stream, const void *data, int frameCount);
 
+static void PostAudioCommand(int type, AudioBuffer *buffer, float value);
+static void ApplyAudioCommandInLockedState(AudioCommand command);
+static void ProcessAudioCommandsInLockedState(void);
+static void WaitAudioCommands(void);
+static bool IsAudioBufferStatePending(AudioBuffer *buffer);
+static void SetAudioBufferStateInLockedState(AudioBuffer *buffer, bool playing, bool paused);
+static void LinkAudioBufferInLockedState(AudioBuffer *buffer);
+static void UnlinkAudioBufferInLockedState(AudioBuffer *buffer);
+static void RetireAudioBuffer(AudioBuffer *buffer, bool freeData);
+static void FreeRetiredAudioBuffers(bool all);
+
 #if defined(RAUDIO_STANDALONE)
 static bool IsFileExtension(const char *fileName, const char *ext); // Check file extension
 static const char *GetFileExtension(const char *fileName);          // Get pointer to extension for a filename string (includes the dot: .png)
@@ -490,15 +600,11 @@ void InitAudioDevice(void)
         return;
     }
 
-    // Mixing happens on a separate thread which means we need to synchronize. I'm using a mutex here to make things simple, but may
-    // want to look at something a bit smarter later on to keep everything real-time, if that's necessary
-    if (ma_mutex_init(&AUDIO.System.lock) != MA_SUCCESS)
-    {
-        TRACELOG(LOG_WARNING, "AUDIO: Failed to create mutex for mixing");
-        ma_device_uninit(&AUDIO.System.device);
-        ma_context_uninit(&AUDIO.System.context);
-        return;
-    }
+    // Mixing happens on a separate thread which means we need to synchronize. Sound calls and buffer (un)tracking go through
+    // the command queue, AUDIO.System.lock (a zero-initialized spinlock, nothing to create) only guards stream refills and processors
+
+    // Must be picked before the device starts calling back
+    SelectMixer();
 
     // Keep the device running the whole time. May want to consider doing something a bit smarter and only have the device running
     // while there's at least one sound being played
@@ -517,6 +623,7 @@ void InitAudioDevice(void)
     TRACELOG(LOG_INFO, "    > Channels:      %d -> %d", AUDIO.System.device.playback.channels, AUDIO.System.device.playback.internalChannels);
     TRACELOG(LOG_INFO, "    > Sample rate:   %d -> %d", AUDIO.System.device.sampleRate, AUDIO.System.device.playback.internalSampleRate);
     TRACELOG(LOG_INFO, "    > Periods size:  %d", AUDIO.System.device.playback.internalPeriodSizeInFrames*AUDIO.System.device.playback.internalPeriods);
+    TRACELOG(LOG_INFO, "    > Mixer:         %s", AUDIO.Mixer.name);
 
     AUDIO.System.isReady = true;
 }
@@ -526,11 +633,17 @@ void CloseAudioDevice(void)
 {
     if (AUDIO.System.isReady)
     {
-        ma_mutex_uninit(&AUDIO.System.lock);
         ma_device_uninit(&AUDIO.System.device);
         ma_context_uninit(&AUDIO.System.context);
 
         AUDIO.System.isReady = false;
+
+        // The mixer is gone, so apply what it didn't get to (tracking included) and free the buffers it held on to
+        ma_spinlock_lock(&AUDIO.System.lock);
+        ProcessAudioCommandsInLockedState();
+        ma_spinlock_unlock(&AUDIO.System.lock);
+        FreeRetiredAudioBuffers(true);
+
         RL_FREE(AUDIO.System.pcmBuffer);
         AUDIO.System.pcmBuffer = NULL;
         AUDIO.System.pcmBufferSize = 0;
@@ -567,6 +680,9 @@ float GetMasterVolume(void)
 // Initialize a new audio buffer (filled with silence)
 AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sampleRate, ma_uint32 sizeInFrames, int usage)
 {
+    // Good moment to free whatever the mixer has let go of since the last load/unload
+    FreeRetiredAudioBuffers(false);
+
     AudioBuffer *audioBuffer = (AudioBuffer *)RL_CALLOC(1, sizeof(AudioBuffer));
 
     if (audioBuffer == NULL)
@@ -598,8 +714,8 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
     audioBuffer->callback = NULL;
     audioBuffer->processor = NULL;
 
-    audioBuffer->playing = false;
-    audioBuffer->paused = false;
+    audioBuffer->playing = MA_FALSE;
+    audioBuffer->paused = MA_FALSE;
     audioBuffer->looping = false;
 
     audioBuffer->usage = usage;
@@ -620,22 +736,27 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
 // Delete an audio buffer
 void UnloadAudioBuffer(AudioBuffer *buffer)
 {
-    if (buffer != NULL)
-    {
-        UntrackAudioBuffer(buffer);
-        ma_data_converter_uninit(&buffer->converter, NULL);
-        RL_FREE(buffer->data);
-        RL_FREE(buffer);
-    }
+    // The mixer may still be reading it, it is freed once the untrack command has been applied
+    if (buffer != NULL) RetireAudioBuffer(buffer, true);
 }
 
 // Check if an audio buffer is playing from a program state without lock
+// NOTE: Commands still waiting in the queue are answered from the game thread view, so a sound
+// reports playing right after PlaySound(), the mixer state is read once they have been applied
 bool IsAudioBufferPlaying(AudioBuffer *buffer)
 {
     bool result = false;
-    ma_mutex_lock(&AUDIO.System.lock);
-    result = IsAudioBufferPlayingInLockedState(buffer);
-    ma_mutex_unlock(&AUDIO.System.lock);
+
+    if (buffer != NULL)
+    {
+        if (IsAudioBufferStatePending(buffer)) result = (buffer->pendingPlaying && !buffer->pendingPaused);
+        else
+        {
+            result = (ma_atomic_load_explicit_32(&buffer->playing, ma_atomic_memory_order_relaxed) &&
+                      !ma_atomic_load_explicit_32(&buffer->paused, ma_atomic_memory_order_relaxed));
+        }
+    }
+
     return result;
 }
 
@@ -644,73 +765,37 @@ bool IsAudioBufferPlaying(AudioBuffer *buffer)
 // Use PauseAudioBuffer() and ResumeAudioBuffer() if the playback position should be maintained
 void PlayAudioBuffer(AudioBuffer *buffer)
 {
-    if (buffer != NULL)
-    {
-        ma_mutex_lock(&AUDIO.System.lock);
-        buffer->playing = true;
-        buffer->paused = false;
-        buffer->frameCursorPos = 0;
-        ma_mutex_unlock(&AUDIO.System.lock);
-    }
+    PostAudioCommand(AUDIO_COMMAND_PLAY, buffer, 0.0f);
 }
 
 // Stop an audio buffer from a program state without lock
 void StopAudioBuffer(AudioBuffer *buffer)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    StopAudioBufferInLockedState(buffer);
-    ma_mutex_unlock(&AUDIO.System.lock);
+    PostAudioCommand(AUDIO_COMMAND_STOP, buffer, 0.0f);
 }
 
 // Pause an audio buffer
 void PauseAudioBuffer(AudioBuffer *buffer)
 {
-    if (buffer != NULL)
-    {
-        ma_mutex_lock(&AUDIO.System.lock);
-        buffer->paused = true;
-        ma_mutex_unlock(&AUDIO.System.lock);
-    }
+    PostAudioCommand(AUDIO_COMMAND_PAUSE, buffer, 0.0f);
 }
 
 // Resume an audio buffer
 void ResumeAudioBuffer(AudioBuffer *buffer)
 {
-    if (buffer != NULL)
-    {
-        ma_mutex_lock(&AUDIO.System.lock);
-        buffer->paused = false;
-        ma_mutex_unlock(&AUDIO.System.lock);
-    }
+    PostAudioCommand(AUDIO_COMMAND_RESUME, buffer, 0.0f);
 }
 
 // Set volume for an audio buffer
 void SetAudioBufferVolume(AudioBuffer *buffer, float volume)
 {
-    if (buffer != NULL)
-    {
-        ma_mutex_lock(&AUDIO.System.lock);
-        buffer->volume = volume;
-        ma_mutex_unlock(&AUDIO.System.lock);
-    }
+    PostAudioCommand(AUDIO_COMMAND_VOLUME, buffer, volume);
 }
 
 // Set pitch for an audio buffer
 void SetAudioBufferPitch(AudioBuffer *buffer, float pitch)
 {
-    if ((buffer != NULL) && (pitch > 0.0f))
-    {
-        ma_mutex_lock(&AUDIO.System.lock);
-        // Pitching is just an adjustment of the sample rate
-        // Note that this changes the duration of the sound:
-        //  - higher pitches will make the sound faster
-        //  - lower pitches make it slower
-        ma_uint32 outputSampleRate = (ma_uint32)((float)buffer->converter.sampleRateOut/pitch);
-        ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, outputSampleRate);
-
-        buffer->pitch = pitch;
-        ma_mutex_unlock(&AUDIO.System.lock);
-    }
+    if (pitch > 0.0f) PostAudioCommand(AUDIO_COMMAND_PITCH, buffer, pitch);
 }
 
 // Set pan for an audio buffer
@@ -719,46 +804,21 @@ void SetAudioBufferPan(AudioBuffer *buffer, float pan)
     if (pan < 0.0f) pan = 0.0f;
     else if (pan > 1.0f) pan = 1.0f;
 
-    if (buffer != NULL)
-    {
-        ma_mutex_lock(&AUDIO.System.lock);
-        buffer->pan = pan;
-        ma_mutex_unlock(&AUDIO.System.lock);
-    }
+    PostAudioCommand(AUDIO_COMMAND_PAN, buffer, pan);
 }
 
 // Track audio buffer to linked list next position
+// NOTE: The mixer owns the list, so the link happens at the start of its next mix
 void TrackAudioBuffer(AudioBuffer *buffer)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    {
-        if (AUDIO.Buffer.first == NULL) AUDIO.Buffer.first = buffer;
-        else
-        {
-            AUDIO.Buffer.last->next = buffer;
-            buffer->prev = AUDIO.Buffer.last;
-        }
-
-        AUDIO.Buffer.last = buffer;
-    }
-    ma_mutex_unlock(&AUDIO.System.lock);
+    PostAudioCommand(AUDIO_COMMAND_TRACK, buffer, 0.0f);
 }
 
 // Untrack audio buffer from linked list
+// NOTE: The mixer may keep reading the buffer until its next mix, see RetireAudioBuffer() before freeing it
 void UntrackAudioBuffer(AudioBuffer *buffer)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    {
-        if (buffer->prev == NULL) AUDIO.Buffer.first = buffer->next;
-        else buffer->prev->next = buffer->next;
-
-        if (buffer->next == NULL) AUDIO.Buffer.last = buffer->prev;
-        else buffer->next->prev = buffer->prev;
-
-        buffer->prev = NULL;
-        buffer->next = NULL;
-    }
-    ma_mutex_unlock(&AUDIO.System.lock);
+    PostAudioCommand(AUDIO_COMMAND_UNTRACK, buffer, 0.0f);
 }
 
 //----------------------------------------------------------------------------------
@@ -1024,12 +1084,7 @@ void UnloadSound(Sound sound)
 void UnloadSoundAlias(Sound alias)
 {
     // Untrack and unload just the sound buffer, not the sample data, it is shared with the source for the alias
-    if (alias.stream.buffer != NULL)
-    {
-        UntrackAudioBuffer(alias.stream.buffer);
-        ma_data_converter_uninit(&alias.stream.buffer->converter, NULL);
-        RL_FREE(alias.stream.buffer);
-    }
+    if (alias.stream.buffer != NULL) RetireAudioBuffer(alias.stream.buffer, false);
 }
 
 // Update sound buffer with new data
@@ -1037,7 +1092,9 @@ void UpdateSound(Sound sound, const void *data, int frameCount)
 {
     if (sound.stream.buffer != NULL)
     {
+        // The mixer must be done reading before the copy, so wait for it to apply the stop
         StopAudioBuffer(sound.stream.buffer);
+        WaitAudioCommands();
 
         memcpy(sound.stream.buffer->data, data, frameCount*ma_get_bytes_per_frame(sound.stream.buffer->converter.formatIn, sound.stream.buffer->converter.channelsIn));
     }
@@ -1318,6 +1375,228 @@ void UnloadWaveSamples(float *samples)
     RL_FREE(samples);
 }
 
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Sound banks
+//----------------------------------------------------------------------------------
+
+// Export waves as a sound bank file, returns true on success
+// NOTE: Waves are converted to the device format and channels at the provided sample rate,
+// so loading the bank needs no decoding or resampling as long as the device runs at that rate
+bool ExportSoundBank(const Wave *waves, const char **names, int count, int sampleRate, const char *fileName)
+{
+    if ((waves == NULL) || (names == NULL) || (count <= 0)) return false;
+
+    const int sampleSize = (int)ma_get_bytes_per_sample(AUDIO_DEVICE_FORMAT)*8;
+    ma_format format = ((sampleSize == 8)? ma_format_u8 : ((sampleSize == 16)? ma_format_s16 : ma_format_f32));
+    if (format != AUDIO_DEVICE_FORMAT)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Device format not supported by sound banks", fileName);
+        return false;
+    }
+
+    Wave *converted = (Wave *)RL_CALLOC(count, sizeof(Wave));
+    SoundBankEntry *entries = (SoundBankEntry *)RL_CALLOC(count, sizeof(SoundBankEntry));
+
+    // Data starts after the index, every sound is aligned
+    unsigned int dataSize = sizeof(SoundBankHeader) + count*sizeof(SoundBankEntry);
+    for (int i = 0; i < count; i++)
+    {
+        converted[i] = WaveCopy(waves[i]);
+        WaveFormat(&converted[i], sampleRate, sampleSize, AUDIO_DEVICE_CHANNELS);
+
+        dataSize = (dataSize + SOUND_BANK_ALIGNMENT - 1)/SOUND_BANK_ALIGNMENT*SOUND_BANK_ALIGNMENT;
+
+        // Names are truncated to fit, keeping the '\0'
+        size_t nameLength = strlen(names[i]);
+        if (nameLength > sizeof(entries[i].name) - 1) nameLength = sizeof(entries[i].name) - 1;
+        memcpy(entries[i].name, names[i], nameLength);
+        entries[i].offset = dataSize;
+        entries[i].frameCount = converted[i].frameCount;
+
+        dataSize += converted[i].frameCount*ma_get_bytes_per_frame(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS);
+    }
+
+    unsigned char *fileData = (unsigned char *)RL_CALLOC(dataSize, 1);
+
+    SoundBankHeader header = { { 'r', 'S', 'B', 'K' }, 1, (unsigned int)AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, (unsigned int)sampleRate, (unsigned int)count };
+    memcpy(fileData, &header, sizeof(SoundBankHeader));
+    memcpy(fileData + sizeof(SoundBankHeader), entries, count*sizeof(SoundBankEntry));
+
+    for (int i = 0; i < count; i++)
+    {
+        memcpy(fileData + entries[i].offset, converted[i].data, entries[i].frameCount*ma_get_bytes_per_frame(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS));
+        UnloadWave(converted[i]);
+    }
+
+    bool success = SaveFileData(fileName, fileData, (int)dataSize);
+
+    RL_FREE(fileData);
+    RL_FREE(entries);
+    RL_FREE(converted);
+
+    if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Sound bank exported successfully (%i sounds)", fileName, count);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export sound bank", fileName);
+
+    return success;
+}
+
+// Load sound bank from file
+// NOTE: File is memory-mapped, not read, pages are brought in by the OS as sounds play
+SoundBank LoadSoundBank(const char *fileName)
+{
+    SoundBank bank = { 0 };
+
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open sound bank", fileName);
+        return bank;
+    }
+
+    LARGE_INTEGER fileSize = { 0 };
+    GetFileSizeEx(file, &fileSize);
+
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);      // The mapping keeps the file open
+
+    if (mapping == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to map sound bank", fileName);
+        return bank;
+    }
+
+    bank.data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    bank.mapping = mapping;
+    bank.dataSize = (unsigned int)fileSize.QuadPart;
+#else
+    int file = open(fileName, O_RDONLY);
+    if (file < 0)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open sound bank", fileName);
+        return bank;
+    }
+
+    struct stat fileStat = { 0 };
+    fstat(file, &fileStat);
+
+    void *data = mmap(NULL, (size_t)fileStat.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+    close(file);            // The mapping keeps the file open
+
+    if (data != MAP_FAILED)
+    {
+        bank.data = data;
+        bank.dataSize = (unsigned int)fileStat.st_size;
+    }
+#endif
+
+    if (bank.data == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to map sound bank", fileName);
+        UnloadSoundBank(bank);
+        memset(&bank, 0, sizeof(SoundBank));
+        return bank;
+    }
+
+    // Validate everything up front, sounds are later used without checks
+    const SoundBankHeader *header = (const SoundBankHeader *)bank.data;
+    bool valid = (bank.dataSize >= sizeof(SoundBankHeader)) && (memcmp(header->id, "rSBK", 4) == 0) && (header->version == 1);
+    if (valid) valid = (bank.dataSize >= sizeof(SoundBankHeader) + header->soundCount*sizeof(SoundBankEntry));
+
+    if (!valid) TRACELOG(LOG_WARNING, "FILEIO: [%s] File is not a valid sound bank", fileName);
+    else if ((header->format != (unsigned int)AUDIO_DEVICE_FORMAT) || (header->channels != AUDIO_DEVICE_CHANNELS) || (header->sampleRate != AUDIO.System.device.sampleRate))
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Sound bank format (%i Hz) does not match the audio device (%i Hz), re-export it", fileName, header->sampleRate, AUDIO.System.device.sampleRate);
+        valid = false;
+    }
+    else
+    {
+        const SoundBankEntry *entries = (const SoundBankEntry *)((const unsigned char *)bank.data + sizeof(SoundBankHeader));
+        const unsigned int frameSize = ma_get_bytes_per_frame(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS);
+
+        for (unsigned int i = 0; valid && (i < header->soundCount); i++)
+        {
+            valid = (entries[i].offset <= bank.dataSize) && (entries[i].frameCount <= (bank.dataSize - entries[i].offset)/frameSize);
+        }
+
+        if (!valid) TRACELOG(LOG_WARNING, "FILEIO: [%s] Sound bank data is truncated", fileName);
+    }
+
+    if (!valid)
+    {
+        UnloadSoundBank(bank);
+        memset(&bank, 0, sizeof(SoundBank));
+        return bank;
+    }
+
+    bank.soundCount = header->soundCount;
+
+    TRACELOG(LOG_INFO, "FILEIO: [%s] Sound bank mapped successfully (%i sounds)", fileName, bank.soundCount);
+
+    return bank;
+}
+
+// Checks if a sound bank is ready
+bool IsSoundBankReady(SoundBank bank)
+{
+    return ((bank.data != NULL) && (bank.soundCount > 0));
+}
+
+// Load sound from a sound bank by name
+// NOTE: Sound data is not copied, it plays straight from the mapped file,
+// unload it with UnloadSoundAlias() and before unloading the bank
+Sound LoadSoundFromBank(SoundBank bank, const char *name)
+{
+    Sound sound = { 0 };
+
+    if (!IsSoundBankReady(bank)) return sound;
+
+    const SoundBankEntry *entries = (const SoundBankEntry *)((const unsigned char *)bank.data + sizeof(SoundBankHeader));
+
+    for (unsigned int i = 0; i < bank.soundCount; i++)
+    {
+        if (strncmp(entries[i].name, name, sizeof(entries[i].name)) != 0) continue;
+
+        AudioBuffer *audioBuffer = LoadAudioBuffer(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, 0, AUDIO_BUFFER_USAGE_STATIC);
+
+        if (audioBuffer == NULL)
+        {
+            TRACELOG(LOG_WARNING, "SOUND: Failed to create buffer");
+            return sound;
+        }
+
+        // Mapped memory is read-only, nothing writes to the data of a static buffer
+        audioBuffer->sizeInFrames = entries[i].frameCount;
+        audioBuffer->data = (unsigned char *)bank.data + entries[i].offset;
+
+        sound.frameCount = entries[i].frameCount;
+        sound.stream.sampleRate = AUDIO.System.device.sampleRate;
+        sound.stream.sampleSize = 32;
+        sound.stream.channels = AUDIO_DEVICE_CHANNELS;
+        sound.stream.buffer = audioBuffer;
+
+        return sound;
+    }
+
+    TRACELOG(LOG_WARNING, "SOUND: [%s] Sound not found in bank", name);
+
+    return sound;
+}
+
+// Unload sound bank, sounds loaded from it must be unloaded first
+void UnloadSoundBank(SoundBank bank)
+{
+    // Unloaded bank sounds stay in the mixer until their untrack command has been applied
+    WaitAudioCommands();
+
+#if defined(_WIN32)
+    if (bank.data != NULL) UnmapViewOfFile(bank.data);
+    if (bank.mapping != NULL) CloseHandle((HANDLE)bank.mapping);
+#else
+    if (bank.data != NULL) munmap(bank.data, bank.dataSize);
+#endif
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Music loading and stream playing
 //----------------------------------------------------------------------------------
@@ -1853,9 +2132,9 @@ void SeekMusicStream(Music music, float position)
         default: break;
     }
 
-    ma_mutex_lock(&AUDIO.System.lock);
+    ma_spinlock_lock(&AUDIO.System.lock);
     music.stream.buffer->framesProcessed = positionInFrames;
-    ma_mutex_unlock(&AUDIO.System.lock);
+    ma_spinlock_unlock(&AUDIO.System.lock);
 }
 
 // Update (re-fill) music buffers if data already processed
@@ -1863,7 +2142,7 @@ void UpdateMusicStream(Music music)
 {
     if (music.stream.buffer == NULL) return;
 
-    ma_mutex_lock(&AUDIO.System.lock);
+    ma_spinlock_lock(&AUDIO.System.lock);
 
     unsigned int subBufferSizeInFrames = music.stream.buffer->sizeInFrames/2;
 
@@ -2008,7 +2287,7 @@ void UpdateMusicStream(Music music)
         {
             if (!music.looping)
             {
-                ma_mutex_unlock(&AUDIO.System.lock);
+                ma_spinlock_unlock(&AUDIO.System.lock);
                 // Streaming is ending, we filled latest frames from input
                 StopMusicStream(music);
                 return;
@@ -2016,7 +2295,7 @@ void UpdateMusicStream(Music music)
         }
     }
 
-    ma_mutex_unlock(&AUDIO.System.lock);
+    ma_spinlock_unlock(&AUDIO.System.lock);
 }
 
 // Check if any music is playing
@@ -2070,7 +2349,7 @@ float GetMusicTimePlayed(Music music)
         else
 #endif
         {
-            ma_mutex_lock(&AUDIO.System.lock);
+            ma_spinlock_lock(&AUDIO.System.lock);
             //ma_uint32 frameSizeInBytes = ma_get_bytes_per_sample(music.stream.buffer->dsp.formatConverterIn.config.formatIn)*music.stream.buffer->dsp.formatConverterIn.config.channels;
             int framesProcessed = (int)music.stream.buffer->framesProcessed;
             int subBufferSize = (int)music.stream.buffer->sizeInFrames/2;
@@ -2080,7 +2359,7 @@ float GetMusicTimePlayed(Music music)
             int framesPlayed = (framesProcessed - framesInFirstBuffer - framesInSecondBuffer + framesSentToMix)%(int)music.frameCount;
             if (framesPlayed < 0) framesPlayed += music.frameCount;
             secondsPlayed = (float)framesPlayed/music.stream.sampleRate;
-            ma_mutex_unlock(&AUDIO.System.lock);
+            ma_spinlock_unlock(&AUDIO.System.lock);
         }
     }
 
@@ -2141,9 +2420,9 @@ void UnloadAudioStream(AudioStream stream)
 // NOTE 2: To dequeue a buffer it needs to be processed: IsAudioStreamProcessed()
 void UpdateAudioStream(AudioStream stream, const void *data, int frameCount)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
+    ma_spinlock_lock(&AUDIO.System.lock);
     UpdateAudioStreamInLockedState(stream, data, frameCount);
-    ma_mutex_unlock(&AUDIO.System.lock);
+    ma_spinlock_unlock(&AUDIO.System.lock);
 }
 
 // Check if any audio stream buffers requires refill
@@ -2152,9 +2431,9 @@ bool IsAudioStreamProcessed(AudioStream stream)
     if (stream.buffer == NULL) return false;
 
     bool result = false;
-    ma_mutex_lock(&AUDIO.System.lock);
+    ma_spinlock_lock(&AUDIO.System.lock);
     result = stream.buffer->isSubBufferProcessed[0] || stream.buffer->isSubBufferProcessed[1];
-    ma_mutex_unlock(&AUDIO.System.lock);
+    ma_spinlock_unlock(&AUDIO.System.lock);
     return result;
 }
 
@@ -2217,9 +2496,9 @@ void SetAudioStreamCallback(AudioStream stream, AudioCallback callback)
 {
     if (stream.buffer != NULL)
     {
-        ma_mutex_lock(&AUDIO.System.lock);
+        ma_spinlock_lock(&AUDIO.System.lock);
         stream.buffer->callback = callback;
-        ma_mutex_unlock(&AUDIO.System.lock);
+        ma_spinlock_unlock(&AUDIO.System.lock);
     }
 }
 
@@ -2228,7 +2507,7 @@ void SetAudioStreamCallback(AudioStream stream, AudioCallback callback)
 // a given stream, we iterate through the list to find the end. That way we don't need a pointer to the last element
 void AttachAudioStreamProcessor(AudioStream stream, AudioCallback process)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
+    ma_spinlock_lock(&AUDIO.System.lock);
 
     rAudioProcessor *processor = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
     processor->process = process;
@@ -2246,13 +2525,13 @@ void AttachAudioStreamProcessor(AudioStream stream, AudioCallback process)
     }
     else stream.buffer->processor = processor;
 
-    ma_mutex_unlock(&AUDIO.System.lock);
+    ma_spinlock_unlock(&AUDIO.System.lock);
 }
 
 // Remove processor from audio stream
 void DetachAudioStreamProcessor(AudioStream stream, AudioCallback process)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
+    ma_spinlock_lock(&AUDIO.System.lock);
 
     rAudioProcessor *processor = stream.buffer->processor;
 
@@ -2273,7 +2552,7 @@ void DetachAudioStreamProcessor(AudioStream stream, AudioCallback process)
         processor = next;
     }
 
-    ma_mutex_unlock(&AUDIO.System.lock);
+    ma_spinlock_unlock(&AUDIO.System.lock);
 }
 
 // Add processor to audio pipeline. Order of processors is important
@@ -2281,7 +2560,7 @@ void DetachAudioStreamProcessor(AudioStream stream, AudioCallback process)
 // these two work on the already mixed output just before sending it to the sound hardware
 void AttachAudioMixedProcessor(AudioCallback process)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
+    ma_spinlock_lock(&AUDIO.System.lock);
 
     rAudioProcessor *processor = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
     processor->process = process;
@@ -2299,13 +2578,13 @@ void AttachAudioMixedProcessor(AudioCallback process)
     }
     else AUDIO.mixedProcessor = processor;
 
-    ma_mutex_unlock(&AUDIO.System.lock);
+    ma_spinlock_unlock(&AUDIO.System.lock);
 }
 
 // Remove processor from audio pipeline
 void DetachAudioMixedProcessor(AudioCallback process)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
+    ma_spinlock_lock(&AUDIO.System.lock);
 
     rAudioProcessor *processor = AUDIO.mixedProcessor;
 
@@ -2326,7 +2605,7 @@ void DetachAudioMixedProcessor(AudioCallback process)
         processor = next;
     }
 
-    ma_mutex_unlock(&AUDIO.System.lock);
+    ma_spinlock_unlock(&AUDIO.System.lock);
 }
 
 
@@ -2491,10 +2770,13 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
     // Mixing is basically just an accumulation, we need to initialize the output buffer to 0
     memset(pFramesOut, 0, frameCount*pDevice->playback.channels*ma_get_bytes_per_sample(pDevice->playback.format));
 
-    // Using a mutex here for thread-safety which makes things not real-time
-    // This is unlikely to be necessary for this project, but may want to consider how you might want to avoid this
-    ma_mutex_lock(&AUDIO.System.lock);
+    // Play/stop/param changes and buffer (un)tracking arrive through the command queue, the game thread
+    // only takes the lock to refill streams or edit processors. Never wait on it here: if it is taken,
+    // this period stays silent and the queued commands are picked up by the next one
+    if (ma_atomic_exchange_explicit_32(&AUDIO.System.lock, 1, ma_atomic_memory_order_acquire) != 0) return;
     {
+        ProcessAudioCommandsInLockedState();
+
         for (AudioBuffer *audioBuffer = AUDIO.Buffer.first; audioBuffer != NULL; audioBuffer = audioBuffer->next)
         {
             // Ignore stopped or paused sounds
@@ -2577,7 +2859,7 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
         processor = processor->next;
     }
 
-    ma_mutex_unlock(&AUDIO.System.lock);
+    ma_spinlock_unlock(&AUDIO.System.lock);
 }
 
 // Main mixing function, pretty simple in this project, just an accumulation
@@ -2595,35 +2877,168 @@ static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 fr
         // Fast sine approximation in [0..1] for pan law: y = 0.5f*x*(3 - x*x);
         const float levels[2] = { localVolume*0.5f*left*(3.0f - left*left), localVolume*0.5f*right*(3.0f - right*right) };
 
-        float *frameOut = framesOut;
-        const float *frameIn = framesIn;
+        AUDIO.Mixer.mix(framesOut, framesIn, frameCount*2, levels[0], levels[1]);
+    }
+    else  // We do not consider panning
+    {
+        // Output accumulates input multiplied by volume to provided output (usually 0)
+        AUDIO.Mixer.mix(framesOut, framesIn, frameCount*channels, localVolume, localVolume);
+    }
+}
 
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
-        {
-            frameOut[0] += (frameIn[0]*levels[0]);
-            frameOut[1] += (frameIn[1]*levels[1]);
+// Pick the fastest mixing kernel supported by the CPU
+// NOTE: The kernel is checked once against the scalar reference, falling back to it on mismatch
+static void SelectMixer(void)
+{
+    AUDIO.Mixer.mix = MixSamplesScalar;
+    AUDIO.Mixer.name = "scalar";
 
-            frameOut += 2;
-            frameIn += 2;
+#if defined(RAUDIO_MIXER_X86)
+    bool avx2 = false;
+#if defined(_MSC_VER)
+    int info[4] = { 0 };
+    __cpuid(info, 0);
+    if (info[0] >= 7)
+    {
+        __cpuid(info, 1);
+        bool fma = (info[2] & (1 << 12)) != 0;
+        bool osxsave = (info[2] & (1 << 27)) != 0;
+
+        // The OS must save the YMM registers on context switches
+        if (fma && osxsave && ((_xgetbv(0) & 0x6) == 0x6))
+        {
+            __cpuidex(info, 7, 0);
+            avx2 = (info[1] & (1 << 5)) != 0;
         }
     }
-    else  // We do not consider panning
+#else
+    __builtin_cpu_init();
+    avx2 = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+
+    MixSamplesFunc candidate = avx2? MixSamplesAVX2 : MixSamplesSSE2;
+    const char *candidateName = avx2? "AVX2" : "SSE2";
+#elif defined(RAUDIO_MIXER_NEON)
+    MixSamplesFunc candidate = MixSamplesNEON;
+    const char *candidateName = "NEON";
+#else
+    MixSamplesFunc candidate = NULL;
+    const char *candidateName = NULL;
+#endif
+
+    if (candidate != NULL)
     {
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
+        // Odd count so the scalar tail is covered too
+        float samplesIn[67] = { 0 };
+        float expected[67] = { 0 };
+        float result[67] = { 0 };
+
+        for (int i = 0; i < 67; i++)
         {
-            for (ma_uint32 c = 0; c < channels; c++)
-            {
-                float *frameOut = framesOut + (frame*channels);
-                const float *frameIn = framesIn + (frame*channels);
+            samplesIn[i] = (float)((i*37)%101)/50.0f - 1.0f;
+            expected[i] = result[i] = (float)(i%7)*0.125f;
+        }
 
-                // Output accumulates input multiplied by volume to provided output (usually 0)
-                frameOut[c] += (frameIn[c]*localVolume);
-            }
+        MixSamplesScalar(expected, samplesIn, 67, 0.75f, 0.25f);
+        candidate(result, samplesIn, 67, 0.75f, 0.25f);
+
+        // FMA rounds once, so allow for the last bit
+        bool match = true;
+        for (int i = 0; i < 67; i++)
+        {
+            float difference = result[i] - expected[i];
+            if ((difference > 1e-5f) || (difference < -1e-5f)) match = false;
+        }
+
+        if (match)
+        {
+            AUDIO.Mixer.mix = candidate;
+            AUDIO.Mixer.name = candidateName;
         }
+        else TRACELOG(LOG_WARNING, "AUDIO: %s mixer does not match the scalar reference, using scalar", candidateName);
+    }
+}
+
+// Scalar reference mixer, the SIMD kernels must produce the same result
+static void MixSamplesScalar(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, float gainEven, float gainOdd)
+{
+    ma_uint32 i = 0;
+
+    for (; (i + 2) <= sampleCount; i += 2)
+    {
+        samplesOut[i] += samplesIn[i]*gainEven;
+        samplesOut[i + 1] += samplesIn[i + 1]*gainOdd;
+    }
+
+    if (i < sampleCount) samplesOut[i] += samplesIn[i]*gainEven;
+}
+
+#if defined(RAUDIO_MIXER_X86)
+// Two stereo frames per iteration
+static void MixSamplesSSE2(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, float gainEven, float gainOdd)
+{
+    const __m128 gains = _mm_setr_ps(gainEven, gainOdd, gainEven, gainOdd);
+    ma_uint32 i = 0;
+
+    for (; (i + 8) <= sampleCount; i += 8)
+    {
+        __m128 out0 = _mm_add_ps(_mm_loadu_ps(samplesOut + i), _mm_mul_ps(_mm_loadu_ps(samplesIn + i), gains));
+        __m128 out1 = _mm_add_ps(_mm_loadu_ps(samplesOut + i + 4), _mm_mul_ps(_mm_loadu_ps(samplesIn + i + 4), gains));
+        _mm_storeu_ps(samplesOut + i, out0);
+        _mm_storeu_ps(samplesOut + i + 4, out1);
+    }
+
+    for (; (i + 4) <= sampleCount; i += 4)
+    {
+        _mm_storeu_ps(samplesOut + i, _mm_add_ps(_mm_loadu_ps(samplesOut + i), _mm_mul_ps(_mm_loadu_ps(samplesIn + i), gains)));
+    }
+
+    // Remaining samples start on an even index, so the gains stay in phase
+    MixSamplesScalar(samplesOut + i, samplesIn + i, sampleCount - i, gainEven, gainOdd);
+}
+
+// Four stereo frames per fused multiply-add
+RAUDIO_TARGET_AVX2
+static void MixSamplesAVX2(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, float gainEven, float gainOdd)
+{
+    const __m256 gains = _mm256_setr_ps(gainEven, gainOdd, gainEven, gainOdd, gainEven, gainOdd, gainEven, gainOdd);
+    ma_uint32 i = 0;
+
+    for (; (i + 16) <= sampleCount; i += 16)
+    {
+        __m256 out0 = _mm256_fmadd_ps(_mm256_loadu_ps(samplesIn + i), gains, _mm256_loadu_ps(samplesOut + i));
+        __m256 out1 = _mm256_fmadd_ps(_mm256_loadu_ps(samplesIn + i + 8), gains, _mm256_loadu_ps(samplesOut + i + 8));
+        _mm256_storeu_ps(samplesOut + i, out0);
+        _mm256_storeu_ps(samplesOut + i + 8, out1);
+    }
+
+    for (; (i + 8) <= sampleCount; i += 8)
+    {
+        _mm256_storeu_ps(samplesOut + i, _mm256_fmadd_ps(_mm256_loadu_ps(samplesIn + i), gains, _mm256_loadu_ps(samplesOut + i)));
+    }
+
+    MixSamplesScalar(samplesOut + i, samplesIn + i, sampleCount - i, gainEven, gainOdd);
+}
+#endif
+
+#if defined(RAUDIO_MIXER_NEON)
+// Two stereo frames per multiply-accumulate
+static void MixSamplesNEON(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, float gainEven, float gainOdd)
+{
+    const float gainPair[4] = { gainEven, gainOdd, gainEven, gainOdd };
+    const float32x4_t gains = vld1q_f32(gainPair);
+    ma_uint32 i = 0;
+
+    for (; (i + 4) <= sampleCount; i += 4)
+    {
+        vst1q_f32(samplesOut + i, vmlaq_f32(vld1q_f32(samplesOut + i), vld1q_f32(samplesIn + i), gains));
     }
+
+    MixSamplesScalar(samplesOut + i, samplesIn + i, sampleCount - i, gainEven, gainOdd);
 }
+#endif
 
-// Check if an audio buffer is playing, assuming the audio system mutex has been locked
+// Check if an audio buffer is playing, assuming the audio system lock has been taken
 static bool IsAudioBufferPlayingInLockedState(AudioBuffer *buffer)
 {
     bool result = false;
@@ -2633,15 +3048,14 @@ static bool IsAudioBufferPlayingInLockedState(AudioBuffer *buffer)
     return result;
 }
 
-// Stop an audio buffer, assuming the audio system mutex has been locked
+// Stop an audio buffer, assuming the audio system lock has been taken
 static void StopAudioBufferInLockedState(AudioBuffer *buffer)
 {
     if (buffer != NULL)
     {
         if (IsAudioBufferPlayingInLockedState(buffer))
         {
-            buffer->playing = false;
-            buffer->paused = false;
+            SetAudioBufferStateInLockedState(buffer, false, false);
             buffer->frameCursorPos = 0;
             buffer->framesProcessed = 0;
             buffer->isSubBufferProcessed[0] = true;
@@ -2650,7 +3064,193 @@ static void StopAudioBufferInLockedState(AudioBuffer *buffer)
     }
 }
 
-// Update audio stream, assuming the audio system mutex has been locked
+// Post a command for the mixer, it is applied at the start of the next mix
+// NOTE: Only the game thread posts (single producer) and only the mixer applies (single consumer),
+// so posting never waits on the mixer unless the queue is full. Don't post with the lock taken
+static void PostAudioCommand(int type, AudioBuffer *buffer, float value)
+{
+    if (buffer == NULL) return;
+
+    AudioCommand command = { type, buffer, value };
+
+    // No device means no mixer to drain the queue
+    if (!AUDIO.System.isReady)
+    {
+        ma_spinlock_lock(&AUDIO.System.lock);
+        ApplyAudioCommandInLockedState(command);
+        ma_spinlock_unlock(&AUDIO.System.lock);
+        return;
+    }
+
+    // A full queue has to wait for the next mix to make room
+    ma_uint32 head = AUDIO.Command.head;
+    while ((head - ma_atomic_load_explicit_32(&AUDIO.Command.tail, ma_atomic_memory_order_acquire)) >= AUDIO_COMMAND_QUEUE_SIZE) ma_yield();
+
+    // Keep the game thread view of playing/paused up to date until the mixer catches up
+    if (type <= AUDIO_COMMAND_RESUME)
+    {
+        if (!IsAudioBufferStatePending(buffer))
+        {
+            buffer->pendingPlaying = ma_atomic_load_explicit_32(&buffer->playing, ma_atomic_memory_order_relaxed);
+            buffer->pendingPaused = ma_atomic_load_explicit_32(&buffer->paused, ma_atomic_memory_order_relaxed);
+        }
+
+        switch (type)
+        {
+            case AUDIO_COMMAND_PLAY: buffer->pendingPlaying = true; buffer->pendingPaused = false; break;
+            case AUDIO_COMMAND_STOP: buffer->pendingPlaying = false; buffer->pendingPaused = false; break;
+            case AUDIO_COMMAND_PAUSE: buffer->pendingPaused = true; break;
+            case AUDIO_COMMAND_RESUME: buffer->pendingPaused = false; break;
+            default: break;
+        }
+
+        buffer->pendingUntil = head + 1;
+    }
+
+    AUDIO.Command.ring[head & (AUDIO_COMMAND_QUEUE_SIZE - 1)] = command;
+
+    // Publish the slot after it has been written
+    ma_atomic_store_explicit_32(&AUDIO.Command.head, head + 1, ma_atomic_memory_order_release);
+}
+
+// Apply a single command, assuming the audio system lock has been taken
+static void ApplyAudioCommandInLockedState(AudioCommand command)
+{
+    AudioBuffer *buffer = command.buffer;
+
+    switch (command.type)
+    {
+        case AUDIO_COMMAND_PLAY:
+        {
+            SetAudioBufferStateInLockedState(buffer, true, false);
+            buffer->frameCursorPos = 0;
+        } break;
+        case AUDIO_COMMAND_STOP: StopAudioBufferInLockedState(buffer); break;
+        case AUDIO_COMMAND_PAUSE: SetAudioBufferStateInLockedState(buffer, buffer->playing, true); break;
+        case AUDIO_COMMAND_RESUME: SetAudioBufferStateInLockedState(buffer, buffer->playing, false); break;
+        case AUDIO_COMMAND_VOLUME: buffer->volume = command.value; break;
+        case AUDIO_COMMAND_PITCH:
+        {
+            // Pitching is just an adjustment of the sample rate
+            // Note that this changes the duration of the sound:
+            //  - higher pitches will make the sound faster
+            //  - lower pitches make it slower
+            ma_uint32 outputSampleRate = (ma_uint32)((float)buffer->converter.sampleRateOut/command.value);
+            ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, outputSampleRate);
+
+            buffer->pitch = command.value;
+        } break;
+        case AUDIO_COMMAND_PAN: buffer->pan = command.value; break;
+        case AUDIO_COMMAND_TRACK: LinkAudioBufferInLockedState(buffer); break;
+        case AUDIO_COMMAND_UNTRACK: UnlinkAudioBufferInLockedState(buffer); break;
+        default: break;
+    }
+}
+
+// Apply all posted commands in order, assuming the audio system lock has been taken
+// NOTE: Only the mixer calls it while the device runs, so the consumer side stays single
+static void ProcessAudioCommandsInLockedState(void)
+{
+    ma_uint32 tail = AUDIO.Command.tail;
+    ma_uint32 head = ma_atomic_load_explicit_32(&AUDIO.Command.head, ma_atomic_memory_order_acquire);
+
+    while (tail != head)
+    {
+        ApplyAudioCommandInLockedState(AUDIO.Command.ring[tail & (AUDIO_COMMAND_QUEUE_SIZE - 1)]);
+        tail++;
+    }
+
+    // Hand the slots back to the producer
+    ma_atomic_store_explicit_32(&AUDIO.Command.tail, tail, ma_atomic_memory_order_release);
+}
+
+// Wait until the mixer has applied every command posted so far
+// NOTE: Never call it with the lock taken, the mixer skips its periods (and the queue) while it is
+static void WaitAudioCommands(void)
+{
+    ma_uint32 head = AUDIO.Command.head;
+    while (ma_atomic_load_explicit_32(&AUDIO.Command.tail, ma_atomic_memory_order_acquire) != head) ma_yield();
+}
+
+// Check if the buffer has play/stop/pause/resume commands the mixer hasn't applied yet
+static bool IsAudioBufferStatePending(AudioBuffer *buffer)
+{
+    ma_uint32 tail = ma_atomic_load_explicit_32(&AUDIO.Command.tail, ma_atomic_memory_order_acquire);
+
+    return ((ma_int32)(buffer->pendingUntil - tail) > 0);
+}
+
+// Set playing/paused, assuming the audio system lock has been taken
+// NOTE: Stored atomically, IsAudioBufferPlaying() reads them from the game thread without the lock
+static void SetAudioBufferStateInLockedState(AudioBuffer *buffer, bool playing, bool paused)
+{
+    ma_atomic_store_explicit_32(&buffer->playing, playing? MA_TRUE : MA_FALSE, ma_atomic_memory_order_relaxed);
+    ma_atomic_store_explicit_32(&buffer->paused, paused? MA_TRUE : MA_FALSE, ma_atomic_memory_order_relaxed);
+}
+
+// Link audio buffer at the end of the mixing list, assuming the audio system lock has been taken
+static void LinkAudioBufferInLockedState(AudioBuffer *buffer)
+{
+    if (AUDIO.Buffer.first == NULL) AUDIO.Buffer.first = buffer;
+    else
+    {
+        AUDIO.Buffer.last->next = buffer;
+        buffer->prev = AUDIO.Buffer.last;
+    }
+
+    AUDIO.Buffer.last = buffer;
+}
+
+// Unlink audio buffer from the mixing list, assuming the audio system lock has been taken
+static void UnlinkAudioBufferInLockedState(AudioBuffer *buffer)
+{
+    if (buffer->prev == NULL) AUDIO.Buffer.first = buffer->next;
+    else buffer->prev->next = buffer->next;
+
+    if (buffer->next == NULL) AUDIO.Buffer.last = buffer->prev;
+    else buffer->next->prev = buffer->prev;
+
+    buffer->prev = NULL;
+    buffer->next = NULL;
+}
+
+// Untrack an audio buffer and hand it to the retired list instead of freeing it
+// NOTE: Commands for the buffer were all posted before its untrack, so once the mixer is past
+// that one nothing references the buffer anymore and FreeRetiredAudioBuffers() can free it
+static void RetireAudioBuffer(AudioBuffer *buffer, bool freeData)
+{
+    UntrackAudioBuffer(buffer);
+
+    buffer->freeData = freeData;
+    buffer->retiredAt = AUDIO.Command.head;
+    buffer->nextRetired = AUDIO.Buffer.retired;
+    AUDIO.Buffer.retired = buffer;
+
+    FreeRetiredAudioBuffers(false);
+}
+
+// Free the retired audio buffers the mixer is done with, or all of them once the device is closed
+static void FreeRetiredAudioBuffers(bool all)
+{
+    ma_uint32 tail = ma_atomic_load_explicit_32(&AUDIO.Command.tail, ma_atomic_memory_order_acquire);
+    AudioBuffer **link = &AUDIO.Buffer.retired;
+
+    while (*link != NULL)
+    {
+        AudioBuffer *buffer = *link;
+
+        if (all || ((ma_int32)(tail - buffer->retiredAt) >= 0))
+        {
+            *link = buffer->nextRetired;
+            ma_data_converter_uninit(&buffer->converter, NULL);
+            if (buffer->freeData) RL_FREE(buffer->data);
+            RL_FREE(buffer);
+        }
+        else link = &buffer->nextRetired;
+    }
+}
+
+// Update audio stream, assuming the audio system lock has been taken
 static void UpdateAudioStreamInLockedState(AudioStream stream, const void *data, int frameCount)
 {
     if (stream.buffer != NULL)
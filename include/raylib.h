@@ -468,6 +468,14 @@ typedef struct Sound {
     unsigned int frameCount;    // Total number of frames (considering channels)
 } Sound;
 
+// SoundBank, pre-decoded sounds packed in a single memory-mapped file
+typedef struct SoundBank {
+    unsigned int soundCount;    // Number of sounds in the bank
+    unsigned int dataSize;      // Mapped file size in bytes
+    void *data;                 // Mapped file data, sounds loaded from the bank point into it
+    void *mapping;              // Platform file mapping handle
+} SoundBank;
+
 // Music, audio stream, anything longer than ~10 seconds should be streamed
 typedef struct Music {
     AudioStream stream;         // Audio stream
@@ -1609,6 +1617,13 @@ RLAPI void UnloadSoundAlias(Sound alias);                             // Unload
 RLAPI bool ExportWave(Wave wave, const char *fileName);               // Export wave data to file, returns true on success
 RLAPI bool ExportWaveAsCode(Wave wave, const char *fileName);         // Export wave sample data to code (.h), returns true on success
 
+// Sound bank loading/unloading functions
+RLAPI bool ExportSoundBank(const Wave *waves, const char **names, int count, int sampleRate, const char *fileName); // Export waves as a pre-decoded sound bank, returns true on success
+RLAPI SoundBank LoadSoundBank(const char *fileName);                  // Load sound bank from file (memory-mapped)
+RLAPI bool IsSoundBankReady(SoundBank bank);                          // Checks if a sound bank is ready
+RLAPI Sound LoadSoundFromBank(SoundBank bank, const char *name);      // Load sound from bank by name, shares the bank data, unload with UnloadSoundAlias()
+RLAPI void UnloadSoundBank(SoundBank bank);                           // Unload sound bank
+
 // Wave/Sound management functions
 RLAPI void PlaySound(Sound sound);                                    // Play a sound
 RLAPI void StopSound(Sound sound);                                    // Stop playing a sound
@@ -0,0 +1,102 @@
+#pragma once
+#include <raylib.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Decodes assets on a pool of worker threads so the window can open before everything is loaded.
+// Jobs should only produce CPU-side data (Wave, Image...). Turning that into audio buffers or
+// textures stays on the main thread, so poll the returned futures with IsReady() once per frame.
+class AssetLoader
+{
+public:
+    // 0 = one worker per core, leaving one for the main thread
+    explicit AssetLoader(unsigned int threadCount = 0)
+    {
+        if (threadCount == 0)
+        {
+            unsigned int cores = std::thread::hardware_concurrency();
+            threadCount = cores > 1 ? cores - 1 : 1;
+        }
+
+        for (unsigned int i = 0; i < threadCount; i++)
+            workers.emplace_back([this] { Work(); });
+    }
+
+    // Finishes every job already submitted, so no future is left broken
+    ~AssetLoader()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        ready.notify_all();
+
+        for (std::thread& worker : workers)
+            worker.join();
+    }
+
+    AssetLoader(const AssetLoader&) = delete;
+    AssetLoader& operator=(const AssetLoader&) = delete;
+
+    template<typename Fn>
+    auto Submit(Fn&& fn) -> std::future<decltype(fn())>
+    {
+        using Result = decltype(fn());
+
+        // std::function needs a copyable target, packaged_task isn't
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Fn>(fn));
+        std::future<Result> result = task->get_future();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            jobs.push_back([task] { (*task)(); });
+        }
+        ready.notify_one();
+        return result;
+    }
+
+    std::future<Wave> LoadWaveAsync(const std::string& fileName)
+    {
+        return Submit([fileName] { return LoadWave(fileName.c_str()); });
+    }
+
+private:
+    void Work()
+    {
+        for (;;)
+        {
+            std::function<void()> job;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                ready.wait(lock, [this] { return stopping || !jobs.empty(); });
+                if (jobs.empty())
+                    return;
+
+                job = std::move(jobs.front());
+                jobs.pop_front();
+            }
+            job();
+        }
+    }
+
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> jobs;
+    std::mutex mutex;
+    std::condition_variable ready;
+    bool stopping = false;
+};
+
+// True once future holds a result, never blocks
+template<typename T>
+bool IsReady(const std::future<T>& future)
+{
+    return future.valid() && future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
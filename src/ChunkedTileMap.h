@@ -0,0 +1,309 @@
+#pragma once
+#include "Tiles.h"
+#include "Grid.h"
+
+#include <memory>
+#include <vector>
+#include <algorithm>
+
+// Tile map of any size, split into CHUNK_SIZE x CHUNK_SIZE chunks.
+//  - a chunk whose tiles are all the same is just that value, storage is only allocated once a
+//    Set() makes it differ, and Compact() frees it again once it's uniform
+//  - every chunk remembers the Version() it last changed at, so renderers & caches can tell which
+//    chunks are dirty for them without the map having to know who's looking
+//  - ForEachChunk() & FloodFill() only visit the chunks a range or region actually covers
+// A 4096x4096 map of mostly grass costs a few KB plus 1 KB per chunk that has something on it.
+class ChunkedTileMap
+{
+public:
+    // 64 cells of 2 bits are exactly two words, so chunk rows have no padding
+    static constexpr int CHUNK_SIZE = 64;
+    using ChunkTiles = TileGrid<CHUNK_SIZE, CHUNK_SIZE>;
+    using ChunkMask = BitGrid<CHUNK_SIZE, CHUNK_SIZE>;
+
+    ChunkedTileMap() = default;
+
+    ChunkedTileMap(int rows, int cols, int fill = GRASS)
+        : rows(rows), cols(cols),
+          chunkRows((rows + CHUNK_SIZE - 1) / CHUNK_SIZE), chunkCols((cols + CHUNK_SIZE - 1) / CHUNK_SIZE),
+          chunks(chunkRows * chunkCols)
+    {
+        for (Chunk& chunk : chunks)
+            chunk.uniform = fill;
+    }
+
+    int Rows() const { return rows; }
+    int Cols() const { return cols; }
+    int ChunkRows() const { return chunkRows; }
+    int ChunkCols() const { return chunkCols; }
+
+    bool InBounds(Cell cell) const
+    {
+        return ::InBounds(cell, rows, cols);
+    }
+
+    int Get(int row, int col) const
+    {
+        const Chunk& chunk = chunks[ChunkIndex(row, col)];
+        return chunk.tiles ? chunk.tiles->Get(row % CHUNK_SIZE, col % CHUNK_SIZE) : chunk.uniform;
+    }
+
+    void Set(int row, int col, int value)
+    {
+        Chunk& chunk = chunks[ChunkIndex(row, col)];
+        if (!chunk.tiles)
+        {
+            if (value == chunk.uniform)
+                return;
+
+            chunk.tiles.reset(new ChunkTiles());
+            chunk.tiles->Fill(chunk.uniform);
+        }
+        else if (chunk.tiles->Get(row % CHUNK_SIZE, col % CHUNK_SIZE) == value)
+        {
+            return;
+        }
+
+        chunk.tiles->Set(row % CHUNK_SIZE, col % CHUNK_SIZE, value);
+        chunk.version = ++version;
+    }
+
+    // Copies a row-major array of Rows() x Cols() tiles in
+    void Load(const int* values)
+    {
+        for (int row = 0; row < rows; row++)
+        {
+            for (int col = 0; col < cols; col++)
+                Set(row, col, values[row * cols + col]);
+        }
+        Compact();
+    }
+
+    // Frees the storage of every chunk that has become uniform. Set() never does this itself so
+    // a chunk being edited doesn't keep getting freed & reallocated.
+    void Compact()
+    {
+        for (int chunkRow = 0; chunkRow < chunkRows; chunkRow++)
+        {
+            for (int chunkCol = 0; chunkCol < chunkCols; chunkCol++)
+            {
+                Chunk& chunk = chunks[chunkRow * chunkCols + chunkCol];
+                if (!chunk.tiles)
+                    continue;
+
+                int value = chunk.tiles->Get(0, 0);
+                if (CountInside(chunkRow, chunkCol, chunk.tiles->Equal(value)) == CellsInside(chunkRow, chunkCol))
+                {
+                    chunk.tiles.reset();
+                    chunk.uniform = value;
+                }
+            }
+        }
+    }
+
+    // Bumped by every Set() that changes a tile
+    unsigned int Version() const { return version; }
+
+    // Version() at the chunk's last change, so it's dirty for anyone who last looked before that
+    unsigned int ChunkVersion(int chunkRow, int chunkCol) const
+    {
+        return chunks[chunkRow * chunkCols + chunkCol].version;
+    }
+
+    // nullptr if the chunk is uniform, see UniformValue()
+    const ChunkTiles* Tiles(int chunkRow, int chunkCol) const
+    {
+        return chunks[chunkRow * chunkCols + chunkCol].tiles.get();
+    }
+
+    int UniformValue(int chunkRow, int chunkCol) const
+    {
+        return chunks[chunkRow * chunkCols + chunkCol].uniform;
+    }
+
+    size_t AllocatedChunks() const
+    {
+        size_t count = 0;
+        for (const Chunk& chunk : chunks)
+            count += chunk.tiles ? 1 : 0;
+        return count;
+    }
+
+    // fn(chunkRow, chunkCol) for every chunk overlapping the (inclusive) cell range, clamped to the map
+    template<typename Fn>
+    void ForEachChunk(int rowMin, int colMin, int rowMax, int colMax, Fn&& fn) const
+    {
+        rowMin = std::max(rowMin, 0);
+        colMin = std::max(colMin, 0);
+        rowMax = std::min(rowMax, rows - 1);
+        colMax = std::min(colMax, cols - 1);
+        for (int chunkRow = rowMin / CHUNK_SIZE; rowMin <= rowMax && chunkRow <= rowMax / CHUNK_SIZE; chunkRow++)
+        {
+            for (int chunkCol = colMin / CHUNK_SIZE; colMin <= colMax && chunkCol <= colMax / CHUNK_SIZE; chunkCol++)
+                fn(chunkRow, chunkCol);
+        }
+    }
+
+    // The cells holding searchValue that are connected to start through non-zero tiles (start
+    // itself is always searched). Floods one chunk at a time with BitGrid::Flood() and hands whatever
+    // reaches a chunk's edge on to the neighbour, so chunks the region never gets to aren't touched.
+    std::vector<Cell> FloodFill(Cell start, TileType searchValue) const
+    {
+        std::vector<Cell> result;
+        if (!InBounds(start))
+            return result;
+
+        // Per chunk: the region so far & the cells that still have to be flooded from
+        std::vector<std::unique_ptr<ChunkMask>> regions(chunks.size());
+        std::vector<std::unique_ptr<ChunkMask>> seeds(chunks.size());
+        std::vector<int> open;
+
+        int startChunk = ChunkIndex(start.row, start.col);
+        seeds[startChunk].reset(new ChunkMask());
+        seeds[startChunk]->Set(start.row % CHUNK_SIZE, start.col % CHUNK_SIZE);
+        open.push_back(startChunk);
+
+        while (!open.empty())
+        {
+            int index = open.back();
+            open.pop_back();
+            int chunkRow = index / chunkCols;
+            int chunkCol = index % chunkCols;
+
+            // The start cell is always searched, even if it's a zero-tile
+            ChunkMask passable = NonZero(chunkRow, chunkCol);
+            if (index == startChunk)
+                passable.Set(start.row % CHUNK_SIZE, start.col % CHUNK_SIZE);
+
+            // The region is already closed within the chunk, so only what's outside it can be new
+            if (!regions[index])
+                regions[index].reset(new ChunkMask());
+            ChunkMask& region = *regions[index];
+            passable.Subtract(region);
+            ChunkMask grown = *seeds[index];
+            seeds[index].reset();
+            grown.Flood(passable);
+            if (!grown.Any())
+                continue;
+            region |= grown;
+
+            // Seed the neighbours with whatever of the new cells touches their edge
+            const int LAST = CHUNK_SIZE - 1;
+            for (int i = 0; i < CHUNK_SIZE; i++)
+            {
+                if (grown.Get(0, i))
+                    Seed(chunkRow - 1, chunkCol, LAST, i, seeds, open);
+                if (grown.Get(LAST, i))
+                    Seed(chunkRow + 1, chunkCol, 0, i, seeds, open);
+                if (grown.Get(i, 0))
+                    Seed(chunkRow, chunkCol - 1, i, LAST, seeds, open);
+                if (grown.Get(i, LAST))
+                    Seed(chunkRow, chunkCol + 1, i, 0, seeds, open);
+            }
+        }
+
+        for (int index = 0; index < (int)chunks.size(); index++)
+        {
+            if (!regions[index])
+                continue;
+
+            int chunkRow = index / chunkCols;
+            int chunkCol = index % chunkCols;
+            ChunkMask matches = *regions[index] & Equal(chunkRow, chunkCol, searchValue);
+            matches.ForEach([&](int row, int col) {
+                result.push_back({ chunkRow * CHUNK_SIZE + row, chunkCol * CHUNK_SIZE + col });
+            });
+        }
+        return result;
+    }
+
+private:
+    struct Chunk
+    {
+        std::unique_ptr<ChunkTiles> tiles;  // nullptr while every tile is uniform
+        int uniform = GRASS;
+        unsigned int version = 0;
+    };
+
+    int ChunkIndex(int row, int col) const
+    {
+        return (row / CHUNK_SIZE) * chunkCols + col / CHUNK_SIZE;
+    }
+
+    // Cells of the chunk that are on the map, chunks along the bottom & right edge can be partial
+    int RowsInside(int chunkRow) const { return std::min(CHUNK_SIZE, rows - chunkRow * CHUNK_SIZE); }
+    int ColsInside(int chunkCol) const { return std::min(CHUNK_SIZE, cols - chunkCol * CHUNK_SIZE); }
+
+    int CellsInside(int chunkRow, int chunkCol) const
+    {
+        return RowsInside(chunkRow) * ColsInside(chunkCol);
+    }
+
+    int CountInside(int chunkRow, int chunkCol, const ChunkMask& mask) const
+    {
+        if (CellsInside(chunkRow, chunkCol) == CHUNK_SIZE * CHUNK_SIZE)
+            return mask.Count();
+
+        int count = 0;
+        mask.ForEach([&](int row, int col) {
+            count += row < RowsInside(chunkRow) && col < ColsInside(chunkCol) ? 1 : 0;
+        });
+        return count;
+    }
+
+    // Only cells on the map, so a flood can't leak into the off-map part of an edge chunk
+    ChunkMask Inside(int chunkRow, int chunkCol) const
+    {
+        ChunkMask mask;
+        for (int row = 0; row < RowsInside(chunkRow); row++)
+        {
+            for (int col = 0; col < ColsInside(chunkCol); col++)
+                mask.Set(row, col);
+        }
+        return mask;
+    }
+
+    ChunkMask Equal(int chunkRow, int chunkCol, int value) const
+    {
+        const Chunk& chunk = chunks[chunkRow * chunkCols + chunkCol];
+        ChunkMask mask;
+        if (chunk.tiles)
+            mask = chunk.tiles->Equal(value);
+        else if (chunk.uniform == value)
+            mask.Fill();
+        return CellsInside(chunkRow, chunkCol) == CHUNK_SIZE * CHUNK_SIZE ? mask : mask & Inside(chunkRow, chunkCol);
+    }
+
+    ChunkMask NonZero(int chunkRow, int chunkCol) const
+    {
+        const Chunk& chunk = chunks[chunkRow * chunkCols + chunkCol];
+        ChunkMask mask;
+        if (chunk.tiles)
+            mask = chunk.tiles->NonZero();
+        else if (chunk.uniform != 0)
+            mask.Fill();
+        return CellsInside(chunkRow, chunkCol) == CHUNK_SIZE * CHUNK_SIZE ? mask : mask & Inside(chunkRow, chunkCol);
+    }
+
+    void Seed(int chunkRow, int chunkCol, int row, int col,
+        std::vector<std::unique_ptr<ChunkMask>>& seeds, std::vector<int>& open) const
+    {
+        if (chunkRow < 0 || chunkRow >= chunkRows || chunkCol < 0 || chunkCol >= chunkCols)
+            return;
+
+        int index = chunkRow * chunkCols + chunkCol;
+        if (!seeds[index])
+        {
+            seeds[index].reset(new ChunkMask());
+            open.push_back(index);
+        }
+        seeds[index]->Set(row, col);
+    }
+
+    int rows = 0;
+    int cols = 0;
+    int chunkRows = 0;
+    int chunkCols = 0;
+    std::vector<Chunk> chunks;      // row-major
+    unsigned int version = 0;
+};
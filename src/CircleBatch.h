@@ -0,0 +1,51 @@
+#pragma once
+#include <raylib.h>
+#include "Math.h"
+
+// Draws circles as tinted quads of one pre-baked circle texture instead of tessellating each one
+// on the CPU (DrawCircleV builds a 36-segment fan per call).
+// Consecutive Draw() calls share a texture, so raylib's render batch collects them into a single
+// vertex buffer & draw call. Keep other draws (shapes, text) out of the middle of a run.
+// Needs a GL context, so Load() after InitWindow() and Unload() before CloseWindow().
+struct CircleBatch
+{
+    static const int TEXTURE_SIZE = 128;
+
+    Texture2D texture{};
+
+    void Load()
+    {
+        // White disc with a one pixel anti-aliased edge, tinted per draw
+        Color* pixels = (Color*)MemAlloc(TEXTURE_SIZE * TEXTURE_SIZE * sizeof(Color));
+        const float radius = TEXTURE_SIZE * 0.5f;
+        for (int y = 0; y < TEXTURE_SIZE; y++)
+        {
+            for (int x = 0; x < TEXTURE_SIZE; x++)
+            {
+                float distance = Length(Vector2{ x + 0.5f - radius, y + 0.5f - radius });
+                float alpha = Clamp(radius - distance, 0.0f, 1.0f);
+                pixels[y * TEXTURE_SIZE + x] = { 255, 255, 255, (unsigned char)(alpha * 255.0f) };
+            }
+        }
+
+        Image image = { pixels, TEXTURE_SIZE, TEXTURE_SIZE, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+        texture = LoadTextureFromImage(image);
+        UnloadImage(image);
+
+        // Small circles (ie vampires) would alias without mipmaps
+        GenTextureMipmaps(&texture);
+        SetTextureFilter(texture, TEXTURE_FILTER_TRILINEAR);
+    }
+
+    void Unload()
+    {
+        UnloadTexture(texture);
+    }
+
+    void Draw(Vector2 center, float radius, Color color) const
+    {
+        Rectangle source = { 0.0f, 0.0f, (float)texture.width, (float)texture.height };
+        Rectangle dest = { center.x - radius, center.y - radius, radius * 2.0f, radius * 2.0f };
+        DrawTexturePro(texture, source, dest, { 0.0f, 0.0f }, 0.0f, color);
+    }
+};
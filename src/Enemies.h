@@ -0,0 +1,42 @@
+#pragma once
+#include <raylib.h>
+#include "Math.h"
+#include "Tiles.h"
+
+#include <cstdint>
+
+enum EnemyType : int
+{
+    BASIC,
+    ZOMBIE,
+    VAMPIRE,
+    ENEMY_TYPE_COUNT
+};
+
+struct EnemyInfo
+{
+    float speed;
+    float radius;
+    float hp;
+    Color color;
+    float spawnInterval;    // seconds between spawns
+};
+
+constexpr EnemyInfo ENEMIES[ENEMY_TYPE_COUNT]
+{
+    //  speed   radius  hp      color   spawn interval
+    { 250.0f, 20.0f, 2.0f, RED, 1.0f },         // BASIC
+    { 30.0f, 40.0f, 20.0f, PURPLE, 1.0f },      // ZOMBIE
+    { 300.0f, 5.0f, 30.0f, ORANGE, 5.0f },      // VAMPIRE
+};
+
+// Every enemy regardless of type, per-type constants are looked up in ENEMIES.
+struct Enemy
+{
+    Vector2 position{};
+    Cell next{};                // tile it's walking to the center of
+    float distance = 0.0f;      // left to walk to the goal
+    float hp = 0.0f;
+    EnemyType type = BASIC;
+    bool enabled = true;
+};
@@ -0,0 +1,303 @@
+#pragma once
+#include <raylib.h>
+#include "Math.h"
+#include "Tiles.h"
+#include "ChunkedTileMap.h"
+
+#include <vector>
+#include <memory>
+#include <queue>
+#include <cstdint>
+#include <climits>
+#include <algorithm>
+#include <functional>
+
+// Routes any number of walkers to one goal over a grid. Every walkable cell knows its step count
+// to the goal (integration field), and the direction field is just "the neighbour one step closer",
+// so steering is a lookup per cell crossed no matter how the map branches.
+// Build() runs a BFS from the goal. After that, cells changing walkability should go through
+// Repair(), which only revisits the cells whose distance actually changes.
+// Distances are stored in the same chunks as ChunkedTileMap, and a chunk with no reachable cell isn't
+// allocated, so a big map only pays for the area that's connected to the goal.
+class FlowField
+{
+public:
+    static constexpr int UNREACHABLE = -1;
+
+    FlowField() = default;
+
+    FlowField(int rows, int cols)
+        : rows(rows), cols(cols), chunkCols((cols + CHUNK_SIZE - 1) / CHUNK_SIZE),
+          chunks(((rows + CHUNK_SIZE - 1) / CHUNK_SIZE) * chunkCols)
+    {
+    }
+
+    // walkable(row, col) decides which cells can be entered, cells outside the grid never can
+    template<typename Walkable>
+    void Build(Cell goal, Walkable&& walkable)
+    {
+        for (std::unique_ptr<Chunk>& chunk : chunks)
+            chunk.reset();
+        open = decltype(open)();
+        this->goal = goal;
+        if (InBounds(goal, rows, cols) && walkable(goal.row, goal.col))
+        {
+            // FIFO over a flat index buffer, every cell is pushed at most once
+            std::vector<int>& queue = scratch;
+            queue.clear();
+            queue.push_back(Index(goal));
+            SetG(Index(goal), 0);
+            for (size_t head = 0; head < queue.size(); head++)
+            {
+                int index = queue[head];
+                Cell cell = CellAt(index);
+                for (Cell dir : DIRECTIONS)
+                {
+                    Cell adj = { cell.row + dir.row, cell.col + dir.col };
+                    if (!InBounds(adj, rows, cols) || G(Index(adj)) != INF || !walkable(adj.row, adj.col))
+                        continue;
+
+                    SetG(Index(adj), G(index) + 1);
+                    queue.push_back(Index(adj));
+                }
+            }
+        }
+
+        // Everything starts out consistent, which is what Repair() relies on
+        for (std::unique_ptr<Chunk>& chunk : chunks)
+        {
+            if (chunk)
+                std::copy(std::begin(chunk->g), std::end(chunk->g), std::begin(chunk->rhs));
+        }
+    }
+
+    // Brings the field up to date after the walkability of cells changed (since the last Build() or Repair()).
+    // LPA* without a heuristic, run until every cell is consistent again: cells whose best neighbour
+    // changed get queued by distance and settled in order, the rest of the grid is never touched.
+    template<typename Walkable>
+    void Repair(const std::vector<Cell>& changed, Walkable&& walkable)
+    {
+        for (Cell cell : changed)
+        {
+            if (!InBounds(cell, rows, cols))
+                continue;
+
+            UpdateCell(cell, walkable);
+            for (Cell dir : DIRECTIONS)
+            {
+                Cell adj = { cell.row + dir.row, cell.col + dir.col };
+                if (InBounds(adj, rows, cols))
+                    UpdateCell(adj, walkable);
+            }
+        }
+
+        while (!open.empty())
+        {
+            QueueEntry entry = open.top();
+            open.pop();
+
+            // Stale entry, the cell was settled or re-queued with another key since
+            int index = entry.second;
+            int g = G(index);
+            int rhs = Rhs(index);
+            if (g == rhs || entry.first != std::min(g, rhs))
+                continue;
+
+            Cell cell = CellAt(index);
+            if (g > rhs)
+            {
+                // Got closer, final now
+                SetG(index, rhs);
+            }
+            else
+            {
+                // Got further or cut off, forget it and let the neighbours tell it its new distance
+                SetG(index, INF);
+                UpdateCell(cell, walkable);
+            }
+
+            for (Cell dir : DIRECTIONS)
+            {
+                Cell adj = { cell.row + dir.row, cell.col + dir.col };
+                if (InBounds(adj, rows, cols))
+                    UpdateCell(adj, walkable);
+            }
+        }
+    }
+
+    template<typename Walkable>
+    void Repair(Cell changed, Walkable&& walkable)
+    {
+        scratchCells.assign(1, changed);
+        Repair(scratchCells, walkable);
+    }
+
+    // Steps to the goal, UNREACHABLE for cells with no route (or outside the grid)
+    int Distance(Cell cell) const
+    {
+        if (!InBounds(cell, rows, cols) || G(Index(cell)) == INF)
+            return UNREACHABLE;
+        return G(Index(cell));
+    }
+
+    bool Reachable(Cell cell) const
+    {
+        return Distance(cell) != UNREACHABLE;
+    }
+
+    // The neighbour one step closer to the goal, cell itself at the goal or where there's no route
+    Cell Next(Cell cell) const
+    {
+        int dir = NextDirection(cell);
+        if (dir < 0)
+            return cell;
+        return { cell.row + DIRECTIONS[dir].row, cell.col + DIRECTIONS[dir].col };
+    }
+
+    // Unit direction to walk in from cell, {0, 0} at the goal or where there's no route
+    Vector2 Direction(Cell cell) const
+    {
+        int dir = NextDirection(cell);
+        if (dir < 0)
+            return { 0.0f, 0.0f };
+        return { (float)DIRECTIONS[dir].col, (float)DIRECTIONS[dir].row };
+    }
+
+    bool Built() const { return goal.row >= 0; }
+    Cell Goal() const { return goal; }
+    int Rows() const { return rows; }
+    int Cols() const { return cols; }
+
+private:
+    static constexpr int INF = INT_MAX;
+
+    // { min(g, rhs), index }, smallest key first
+    using QueueEntry = std::pair<int, int>;
+
+    static constexpr int CHUNK_SIZE = ChunkedTileMap::CHUNK_SIZE;
+
+    struct Chunk
+    {
+        int g[CHUNK_SIZE * CHUNK_SIZE];     // integration field, INF = unreachable
+        int rhs[CHUNK_SIZE * CHUNK_SIZE];   // one-step lookahead of g, differs only while repairing
+    };
+
+    static constexpr int CHUNK_CELLS = CHUNK_SIZE * CHUNK_SIZE;
+
+    // Cells are numbered chunk by chunk, so finding a cell's chunk & slot is a shift and a mask
+    int Index(Cell cell) const
+    {
+        int chunk = (cell.row / CHUNK_SIZE) * chunkCols + cell.col / CHUNK_SIZE;
+        return chunk * CHUNK_CELLS + (cell.row % CHUNK_SIZE) * CHUNK_SIZE + cell.col % CHUNK_SIZE;
+    }
+
+    Cell CellAt(int index) const
+    {
+        int chunk = ChunkOf(index);
+        int slot = CellOf(index);
+        return { (chunk / chunkCols) * CHUNK_SIZE + slot / CHUNK_SIZE, (chunk % chunkCols) * CHUNK_SIZE + slot % CHUNK_SIZE };
+    }
+
+    int ChunkOf(int index) const { return index / CHUNK_CELLS; }
+    int CellOf(int index) const { return index % CHUNK_CELLS; }
+
+    int G(int index) const
+    {
+        const Chunk* chunk = chunks[ChunkOf(index)].get();
+        return chunk ? chunk->g[CellOf(index)] : INF;
+    }
+
+    int Rhs(int index) const
+    {
+        const Chunk* chunk = chunks[ChunkOf(index)].get();
+        return chunk ? chunk->rhs[CellOf(index)] : INF;
+    }
+
+    void SetG(int index, int value)
+    {
+        Chunk* chunk = value == INF ? chunks[ChunkOf(index)].get() : &Allocate(index);
+        if (chunk)
+            chunk->g[CellOf(index)] = value;
+    }
+
+    void SetRhs(int index, int value)
+    {
+        Chunk* chunk = value == INF ? chunks[ChunkOf(index)].get() : &Allocate(index);
+        if (chunk)
+            chunk->rhs[CellOf(index)] = value;
+    }
+
+    // Chunks start out unreachable, same as a missing one
+    Chunk& Allocate(int index)
+    {
+        std::unique_ptr<Chunk>& chunk = chunks[ChunkOf(index)];
+        if (!chunk)
+        {
+            chunk.reset(new Chunk());
+            std::fill(std::begin(chunk->g), std::end(chunk->g), INF);
+            std::fill(std::begin(chunk->rhs), std::end(chunk->rhs), INF);
+        }
+        return *chunk;
+    }
+
+    // Index into DIRECTIONS of the first neighbour one step closer, -1 if there's none
+    int NextDirection(Cell cell) const
+    {
+        if (!InBounds(cell, rows, cols))
+            return -1;
+        int distance = G(Index(cell));
+        if (distance == INF || distance == 0)
+            return -1;
+
+        for (int i = 0; i < (int)DIRECTIONS.size(); i++)
+        {
+            Cell adj = { cell.row + DIRECTIONS[i].row, cell.col + DIRECTIONS[i].col };
+            if (InBounds(adj, rows, cols) && G(Index(adj)) == distance - 1)
+                return i;
+        }
+        return -1;
+    }
+
+    // Recomputes the best distance cell could have from its neighbours and queues it if that
+    // disagrees with the distance it has
+    template<typename Walkable>
+    void UpdateCell(Cell cell, Walkable&& walkable)
+    {
+        int index = Index(cell);
+        if (!walkable(cell.row, cell.col))
+        {
+            SetRhs(index, INF);
+        }
+        else if (cell.row == goal.row && cell.col == goal.col)
+        {
+            SetRhs(index, 0);
+        }
+        else
+        {
+            int best = INF;
+            for (Cell dir : DIRECTIONS)
+            {
+                Cell adj = { cell.row + dir.row, cell.col + dir.col };
+                if (InBounds(adj, rows, cols) && G(Index(adj)) != INF)
+                    best = std::min(best, G(Index(adj)) + 1);
+            }
+            SetRhs(index, best);
+        }
+
+        int g = G(index);
+        int rhs = Rhs(index);
+        if (g != rhs)
+            open.push({ std::min(g, rhs), index });
+    }
+
+    int rows = 0;
+    int cols = 0;
+    Cell goal{ -1, -1 };
+    int chunkCols = 0;
+    std::vector<std::unique_ptr<Chunk>> chunks;     // row-major, nullptr = every cell unreachable
+    std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> open;
+
+    // Kept to avoid reallocating on every build/repair
+    std::vector<int> scratch;
+    std::vector<Cell> scratchCells;
+};
@@ -0,0 +1,305 @@
+#pragma once
+
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// Fixed size grids packed into 64-bit words. Every row starts on a fresh word, so a row is a run of
+// whole words and moving up/down a row is moving ROW_WORDS words. Bits/cells past Width in the last
+// word of a row are padding and always zero.
+
+// Index of the lowest set bit, x must not be 0
+inline int LowestBit(uint64_t x)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, x);
+    return (int)index;
+#else
+    return __builtin_ctzll(x);
+#endif
+}
+
+inline int CountBits(uint64_t x)
+{
+    x = x - ((x >> 1) & 0x5555555555555555ull);
+    x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+    return (int)((x * 0x0101010101010101ull) >> 56);
+}
+
+// One bit per cell, for visited/closed sets and masks such as "walkable".
+// The set ops work a word (64 cells) at a time, Flood() grows a region with shifts instead of a queue.
+template<int Width, int Height>
+class BitGrid
+{
+public:
+    static constexpr int ROW_WORDS = (Width + 63) / 64;
+    static constexpr int WORDS = ROW_WORDS * Height;
+
+    BitGrid()
+    {
+        Clear();
+    }
+
+    bool Get(int row, int col) const
+    {
+        return (words[row * ROW_WORDS + col / 64] >> (col % 64)) & 1;
+    }
+
+    void Set(int row, int col, bool value = true)
+    {
+        uint64_t& word = words[row * ROW_WORDS + col / 64];
+        uint64_t bit = 1ull << (col % 64);
+        word = value ? word | bit : word & ~bit;
+    }
+
+    void Clear()
+    {
+        for (uint64_t& word : words)
+            word = 0;
+    }
+
+    void Fill()
+    {
+        for (int i = 0; i < WORDS; i++)
+            words[i] = RowMask(i % ROW_WORDS);
+    }
+
+    int Count() const
+    {
+        int count = 0;
+        for (uint64_t word : words)
+            count += CountBits(word);
+        return count;
+    }
+
+    bool Any() const
+    {
+        for (uint64_t word : words)
+        {
+            if (word != 0)
+                return true;
+        }
+        return false;
+    }
+
+    BitGrid& operator&=(const BitGrid& other)
+    {
+        for (int i = 0; i < WORDS; i++)
+            words[i] &= other.words[i];
+        return *this;
+    }
+
+    BitGrid& operator|=(const BitGrid& other)
+    {
+        for (int i = 0; i < WORDS; i++)
+            words[i] |= other.words[i];
+        return *this;
+    }
+
+    BitGrid& operator^=(const BitGrid& other)
+    {
+        for (int i = 0; i < WORDS; i++)
+            words[i] ^= other.words[i];
+        return *this;
+    }
+
+    // Removes every cell set in other
+    BitGrid& Subtract(const BitGrid& other)
+    {
+        for (int i = 0; i < WORDS; i++)
+            words[i] &= ~other.words[i];
+        return *this;
+    }
+
+    friend BitGrid operator&(BitGrid a, const BitGrid& b) { return a &= b; }
+    friend BitGrid operator|(BitGrid a, const BitGrid& b) { return a |= b; }
+    friend BitGrid operator^(BitGrid a, const BitGrid& b) { return a ^= b; }
+
+    bool operator==(const BitGrid& other) const
+    {
+        for (int i = 0; i < WORDS; i++)
+        {
+            if (words[i] != other.words[i])
+                return false;
+        }
+        return true;
+    }
+
+    bool operator!=(const BitGrid& other) const
+    {
+        return !(*this == other);
+    }
+
+    // Grows the set cells until they cover every passable cell connected to them
+    void Flood(const BitGrid& passable)
+    {
+        *this &= passable;
+        while (Spread(passable)) {}
+    }
+
+    // fn(row, col) for every set cell, row-major
+    template<typename Fn>
+    void ForEach(Fn&& fn) const
+    {
+        for (int i = 0; i < WORDS; i++)
+        {
+            for (uint64_t word = words[i]; word != 0; word &= word - 1)
+                fn(i / ROW_WORDS, (i % ROW_WORDS) * 64 + LowestBit(word));
+        }
+    }
+
+    const uint64_t* Words() const { return words; }
+    uint64_t* Words() { return words; }
+
+    // Bits of word w of a row that are real cells rather than padding
+    static uint64_t RowMask(int w)
+    {
+        int cols = Width - w * 64;
+        return cols >= 64 ? ~0ull : (1ull << cols) - 1;
+    }
+
+private:
+    // Grows every set cell into its 4 neighbours (and further, since it works in place), but only
+    // onto passable cells. Returns false once nothing changes.
+    bool Spread(const BitGrid& passable)
+    {
+        bool changed = false;
+        for (int row = 0; row < Height; row++)
+        {
+            for (int w = 0; w < ROW_WORDS; w++)
+            {
+                int i = row * ROW_WORDS + w;
+                uint64_t word = words[i];
+
+                // Left/right neighbours, carrying across the words of the row
+                uint64_t left = word << 1;
+                uint64_t right = word >> 1;
+                if (w > 0)
+                    left |= words[i - 1] >> 63;
+                if (w < ROW_WORDS - 1)
+                    right |= words[i + 1] << 63;
+
+                uint64_t up = row > 0 ? words[i - ROW_WORDS] : 0;
+                uint64_t down = row < Height - 1 ? words[i + ROW_WORDS] : 0;
+
+                uint64_t grown = (word | left | right | up | down) & passable.words[i];
+                changed |= grown != word;
+                words[i] = grown;
+            }
+        }
+        return changed;
+    }
+
+    uint64_t words[WORDS];
+};
+
+// Tile storage with Bits (2, 4 or 8) bits per cell, so 2-bit tiles fit a 20x20 map in 320 bytes
+// instead of 1600 as ints. Equal() and NonZero() compare a whole word of cells at once and hand back
+// a BitGrid, which is what flood fills & walkability checks should run on.
+template<int Width, int Height, int Bits = 2>
+class TileGrid
+{
+public:
+    static_assert(Bits == 2 || Bits == 4 || Bits == 8, "TileGrid supports 2, 4 or 8 bits per cell");
+
+    static constexpr int CELLS_PER_WORD = 64 / Bits;
+    static constexpr int ROW_WORDS = BitGrid<Width, Height>::ROW_WORDS * Bits;  // lines up with BitGrid rows
+    static constexpr int WORDS = ROW_WORDS * Height;
+    static constexpr uint64_t CELL_MASK = (1ull << Bits) - 1;
+    static constexpr uint64_t LOW_BITS = ~0ull / CELL_MASK;    // lowest bit of every cell
+
+    TileGrid()
+    {
+        Fill(0);
+    }
+
+    int Get(int row, int col) const
+    {
+        return (int)((words[row * ROW_WORDS + col / CELLS_PER_WORD] >> (col % CELLS_PER_WORD * Bits)) & CELL_MASK);
+    }
+
+    void Set(int row, int col, int value)
+    {
+        uint64_t& word = words[row * ROW_WORDS + col / CELLS_PER_WORD];
+        int shift = col % CELLS_PER_WORD * Bits;
+        word = (word & ~(CELL_MASK << shift)) | (((uint64_t)value & CELL_MASK) << shift);
+    }
+
+    // Sets every cell to value, padding included
+    void Fill(int value)
+    {
+        uint64_t word = ((uint64_t)value & CELL_MASK) * LOW_BITS;
+        for (uint64_t& w : words)
+            w = word;
+    }
+
+    // Copies a plain row-major array in, ie a map written out as int[Height][Width]
+    void Load(const int* values)
+    {
+        for (int row = 0; row < Height; row++)
+        {
+            for (int col = 0; col < Width; col++)
+                Set(row, col, values[row * Width + col]);
+        }
+    }
+
+    // Cells holding value
+    BitGrid<Width, Height> Equal(int value) const
+    {
+        uint64_t broadcast = ((uint64_t)value & CELL_MASK) * LOW_BITS;
+        return Select([broadcast](uint64_t word) { return ~NonZeroCells(word ^ broadcast) & LOW_BITS; });
+    }
+
+    // Cells holding anything but 0
+    BitGrid<Width, Height> NonZero() const
+    {
+        return Select([](uint64_t word) { return NonZeroCells(word); });
+    }
+
+private:
+    // Lowest bit of every cell that has any of its bits set
+    static uint64_t NonZeroCells(uint64_t word)
+    {
+        for (int shift = Bits / 2; shift > 0; shift /= 2)
+            word |= word >> shift;
+        return word & LOW_BITS;
+    }
+
+    // Moves the lowest bit of every cell down next to each other, pairs of runs at a time:
+    // cell i's bit goes from i * Bits to i
+    static uint64_t Compress(uint64_t x)
+    {
+        for (int span = 1; span < CELLS_PER_WORD; span *= 2)
+        {
+            // Runs of 2 * span bits every 2 * span * Bits bits
+            uint64_t keep = 0;
+            for (int i = 0; i < 64; i += 2 * span * Bits)
+                keep |= ((1ull << (2 * span)) - 1) << i;
+            x = (x | (x >> (span * (Bits - 1)))) & keep;
+        }
+        return x;
+    }
+
+    // Builds a BitGrid from match(word), which returns the lowest bit of every matching cell
+    template<typename Match>
+    BitGrid<Width, Height> Select(Match&& match) const
+    {
+        BitGrid<Width, Height> result;
+        uint64_t* out = result.Words();
+        for (int i = 0; i < BitGrid<Width, Height>::WORDS; i++)
+        {
+            // Bits tile words make up one word of the bit grid
+            uint64_t bits = 0;
+            for (int k = 0; k < Bits; k++)
+                bits |= Compress(match(words[i * Bits + k])) << (k * CELLS_PER_WORD);
+            out[i] = bits & BitGrid<Width, Height>::RowMask(i % BitGrid<Width, Height>::ROW_WORDS);
+        }
+        return result;
+    }
+
+    uint64_t words[WORDS];
+};
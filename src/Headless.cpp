@@ -0,0 +1,47 @@
+// Runs the simulation without a window or audio device, as fast as possible.
+// Usage: headless [ticks] (defaults to 100000 ticks of SIMULATION_DT)
+//
+// Only needs raylib's headers, not the library, so it also builds on render-less boxes:
+//   g++ -O2 -std=c++17 -Iinclude src/Headless.cpp src/Simulation.cpp -o headless
+#include "Simulation.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+int main(int argc, char** argv)
+{
+    long long ticks = argc > 1 ? atoll(argv[1]) : 100000;
+    if (ticks <= 0)
+    {
+        printf("Usage: %s [ticks]\n", argv[0]);
+        return 1;
+    }
+
+    Simulation sim;
+
+    // One turret per weapon alongside the path so there's something to shoot with
+    sim.PlaceTurret(TileCenter(4, 13), BULLET, FIRST);
+    sim.PlaceTurret(TileCenter(10, 4), MISSILE, NEAREST);
+    sim.PlaceTurret(TileCenter(16, 15), GRENADE, STRONGEST);
+    SimulationEvents totals;
+
+    auto start = std::chrono::steady_clock::now();
+    for (long long tick = 0; tick < ticks; tick++)
+    {
+        sim.Step(SIMULATION_DT);
+        totals.shots += sim.events.shots;
+        totals.hits += sim.events.hits;
+        totals.deaths += sim.events.deaths;
+        sim.events = {};
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    printf("Ticks: %lld (%.1f simulated seconds)\n", ticks, ticks * SIMULATION_DT);
+    printf("Wall time: %.3f s\n", seconds);
+    printf("Ticks per second: %.0f\n", seconds > 0.0 ? ticks / seconds : 0.0);
+    printf("Enemies: %zu, projectiles: %zu\n", sim.enemies.Count(), sim.projectiles.Count());
+    printf("Shots: %d, hits: %d, deaths: %d\n", totals.shots, totals.hits, totals.deaths);
+    return 0;
+}
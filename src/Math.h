@@ -1,6 +1,9 @@
 #pragma once
-#include <corecrt_math.h>
+#include <math.h>
 #include <cstdlib>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -33,6 +36,35 @@
 #define Vector3ToFloat(vec) (ToFloatV(vec).v)
 #endif
 
+// Floats per SIMD register used by the batch (*N) functions, 1 = scalar only
+// Define MATH_SIMD_WIDTH before including to force a narrower path
+#if !defined(MATH_SIMD_WIDTH)
+#if defined(__AVX__)
+#define MATH_SIMD_WIDTH 8
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MATH_SIMD_WIDTH 4
+#else
+#define MATH_SIMD_WIDTH 1
+#endif
+#endif
+
+#if MATH_SIMD_WIDTH == 8
+#include <immintrin.h>
+#elif MATH_SIMD_WIDTH == 4
+#include <emmintrin.h>
+#endif
+
+// Matrix & quaternion functions (Invert, Transpose, Multiply(Quaternion, Matrix)) use SSE when available
+// (VEX encoded in AVX builds). Define MATH_SIMD_MATRIX 0 before including to force the scalar code,
+// the *Scalar versions are always there as reference and mathcheck compares the two
+#if !defined(MATH_SIMD_MATRIX)
+#define MATH_SIMD_MATRIX (MATH_SIMD_WIDTH >= 4)
+#endif
+
+#if MATH_SIMD_MATRIX && MATH_SIMD_WIDTH < 4
+#error "MATH_SIMD_MATRIX needs MATH_SIMD_WIDTH 4 or 8"
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
@@ -92,14 +124,188 @@ typedef struct float16 {
     float v[16]{};
 } float16;
 
+// xoshiro128** generator state, seed with RandomSeed()
+// NOTE: Not thread-safe, give each subsystem/thread its own
+typedef struct RandomState {
+    uint32_t s[4];
+} RandomState;
+
+// 4 independent xoshiro128+ lanes stepped together, seed with RandomBatchSeed()
+// NOTE: Stored lane-wise so the per-lane loops compile to SIMD
+typedef struct RandomBatchState {
+    uint32_t s0[4];
+    uint32_t s1[4];
+    uint32_t s2[4];
+    uint32_t s3[4];
+} RandomBatchState;
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Random numbers
+//----------------------------------------------------------------------------------
+
+// splitmix64 step, spreads a seed over the generator state
+RMAPI uint64_t RandomSplitMix(uint64_t* x)
+{
+    uint64_t z = (*x += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+RMAPI uint32_t RandomRotl(uint32_t x, int k)
+{
+    return (x << k) | (x >> (32 - k));
+}
+
+// Same seed, same sequence on every platform
+RMAPI RandomState RandomSeed(uint64_t seed)
+{
+    RandomState state = { 0 };
+    uint64_t a = RandomSplitMix(&seed);
+    uint64_t b = RandomSplitMix(&seed);
+    state.s[0] = (uint32_t)a;
+    state.s[1] = (uint32_t)(a >> 32);
+    state.s[2] = (uint32_t)b;
+    state.s[3] = (uint32_t)(b >> 32);
+    return state;
+}
+
+// Next 32 random bits
+RMAPI uint32_t RandomNext(RandomState* state)
+{
+    uint32_t* s = state->s;
+    uint32_t result = RandomRotl(s[1] * 5, 7) * 9;
+    uint32_t t = s[1] << 9;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = RandomRotl(s[3], 11);
+
+    return result;
+}
+
+// Top 24 bits as a float in [0, 1)
+RMAPI float RandomBitsToFloat(uint32_t bits)
+{
+    return (float)(bits >> 8) * (1.0f / 16777216.0f);
+}
+
+// Random value in [min, max)
+RMAPI float Random(RandomState* state, float min, float max)
+{
+    return min + RandomBitsToFloat(RandomNext(state)) * (max - min);
+}
+
+// Random integer in [min, max], without modulo bias worth caring about (ranges well below 2^32)
+RMAPI int RandomInt(RandomState* state, int min, int max)
+{
+    uint64_t range = (uint64_t)((int64_t)max - (int64_t)min + 1);
+    return (int)((int64_t)min + (int64_t)(((uint64_t)RandomNext(state) * range) >> 32));
+}
+
+// Random direction scaled to [minLength, maxLength)
+RMAPI Vector2 RandomVector(RandomState* state, float minLength, float maxLength)
+{
+    float angle = Random(state, 0.0f, 2.0f * PI);
+    float length = Random(state, minLength, maxLength);
+    return { cosf(angle) * length, sinf(angle) * length };
+}
+
+// Seed 4 lanes from one seed, lanes never share a sequence
+RMAPI RandomBatchState RandomBatchSeed(uint64_t seed)
+{
+    RandomBatchState state = { 0 };
+    for (int lane = 0; lane < 4; lane++)
+    {
+        RandomState laneState = RandomSeed(seed + (uint64_t)lane * 0x632BE59BD9B4E019ull);
+        state.s0[lane] = laneState.s[0];
+        state.s1[lane] = laneState.s[1];
+        state.s2[lane] = laneState.s[2];
+        state.s3[lane] = laneState.s[3];
+    }
+    return state;
+}
+
+// Next 32 random bits for each of the 4 lanes (xoshiro128+, fine for floats, weak low bits)
+RMAPI void RandomBatchNext(RandomBatchState* state, uint32_t out[4])
+{
+    for (int lane = 0; lane < 4; lane++)
+    {
+        uint32_t s0 = state->s0[lane];
+        uint32_t s1 = state->s1[lane];
+        uint32_t s2 = state->s2[lane] ^ s0;
+        uint32_t s3 = state->s3[lane] ^ s1;
+
+        out[lane] = s0 + state->s3[lane];
+
+        state->s0[lane] = s0 ^ s3;
+        state->s1[lane] = s1 ^ s2;
+        state->s2[lane] = s2 ^ (s1 << 9);
+        state->s3[lane] = RandomRotl(s3, 11);
+    }
+}
+
+// Fill values with count random floats in [min, max)
+RMAPI void RandomFill(RandomBatchState* state, float* values, size_t count, float min, float max)
+{
+    const float range = max - min;
+    uint32_t bits[4];
+    size_t i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+        RandomBatchNext(state, bits);
+        for (int lane = 0; lane < 4; lane++)
+            values[i + lane] = min + RandomBitsToFloat(bits[lane]) * range;
+    }
+
+    if (i < count)
+    {
+        RandomBatchNext(state, bits);
+        for (int lane = 0; lane < 4 && i < count; lane++, i++)
+            values[i] = min + RandomBitsToFloat(bits[lane]) * range;
+    }
+}
+
+// Fill vectors with count random points in the box [min, max)
+RMAPI void RandomFill(RandomBatchState* state, Vector2* vectors, size_t count, Vector2 min, Vector2 max)
+{
+    // Vector2 is two packed floats, fill x,y pairs then rescale y
+    float* values = &vectors[0].x;
+    RandomFill(state, values, count * 2, 0.0f, 1.0f);
+
+    const Vector2 range = { max.x - min.x, max.y - min.y };
+    for (size_t i = 0; i < count; i++)
+    {
+        vectors[i].x = min.x + vectors[i].x * range.x;
+        vectors[i].y = min.y + vectors[i].y * range.y;
+    }
+}
+
+// Shared generator behind Random(min, max), reseed with SeedRandom() for replays
+RMAPI RandomState& DefaultRandomState()
+{
+    static RandomState state = RandomSeed(0x5EED5EED5EEDull);
+    return state;
+}
+
+RMAPI void SeedRandom(uint64_t seed)
+{
+    DefaultRandomState() = RandomSeed(seed);
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Utils math
 //----------------------------------------------------------------------------------
 
 // Random value between min and max (can be negative)
+// NOTE: Uses the shared generator, prefer a RandomState per subsystem
 RMAPI float Random(float min, float max)
 {
-    return min + (rand() / ((float)RAND_MAX / (max - min)));
+    return Random(&DefaultRandomState(), min, max);
 }
 
 // Clamp float value
@@ -370,6 +576,44 @@ RMAPI Vector2 Normalize(Vector2 v)
     return result;
 }
 
+// Approximate 1/sqrtf(x) for x > 0, see NormalizeFast() for the error bounds
+RMAPI float RsqrtFast(float x)
+{
+#if MATH_SIMD_WIDTH >= 4
+    float y = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)));
+#else
+    // Bit-level initial guess
+    uint32_t bits = 0;
+    memcpy(&bits, &x, sizeof(bits));
+    bits = 0x5F375A86u - (bits >> 1);
+    float y = 0.0f;
+    memcpy(&y, &bits, sizeof(y));
+#endif
+
+    // One Newton-Raphson step
+    return y * (1.5f - 0.5f * x * y * y);
+}
+
+// Normalize provided vector using an approximate inverse square root
+// Relative error of the result length (1 is exact):
+//  - SSE/AVX builds (rsqrtss + Newton step): below 5e-7, a few ulps
+//  - scalar builds (bit trick + Newton step): below 1.8e-3
+// Fine for directions, not for anything that accumulates
+RMAPI Vector2 NormalizeFast(Vector2 v)
+{
+    Vector2 result = { 0 };
+    float lengthSqr = (v.x * v.x) + (v.y * v.y);
+
+    if (lengthSqr > 0)
+    {
+        float ilength = RsqrtFast(lengthSqr);
+        result.x = v.x * ilength;
+        result.y = v.y * ilength;
+    }
+
+    return result;
+}
+
 // Transforms a Vector2 by a given Matrix
 RMAPI Vector2 Multiply(Vector2 v, Matrix mat)
 {
@@ -505,6 +749,225 @@ RMAPI bool Equals(Vector2 p, Vector2 q)
     return result;
 }
 
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Vector2 batch math
+//----------------------------------------------------------------------------------
+// NOTE: Every batch function matches calling its scalar version in a loop, the SIMD paths use
+// the same operations in the same order (no FMA), mathcheck holds them to that. out may alias an input.
+
+// Normalize count vectors
+RMAPI void NormalizeN(Vector2* out, const Vector2* in, size_t count)
+{
+    size_t i = 0;
+
+#if MATH_SIMD_WIDTH >= 4
+    const float* src = &in[0].x;
+    float* dst = &out[0].x;
+#endif
+
+#if MATH_SIMD_WIDTH == 8
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 zero = _mm256_setzero_ps();
+    for (; i + 4 <= count; i += 4)
+    {
+        // x0 y0 x1 y1 | x2 y2 x3 y3, the swap gives every component its partner
+        __m256 v = _mm256_loadu_ps(src + i * 2);
+        __m256 sq = _mm256_mul_ps(v, v);
+        __m256 length = _mm256_sqrt_ps(_mm256_add_ps(sq, _mm256_permute_ps(sq, _MM_SHUFFLE(2, 3, 0, 1))));
+        __m256 ilength = _mm256_div_ps(one, length);
+        __m256 valid = _mm256_cmp_ps(length, zero, _CMP_GT_OQ);
+        _mm256_storeu_ps(dst + i * 2, _mm256_and_ps(valid, _mm256_mul_ps(v, ilength)));
+    }
+#elif MATH_SIMD_WIDTH == 4
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 zero = _mm_setzero_ps();
+    for (; i + 2 <= count; i += 2)
+    {
+        __m128 v = _mm_loadu_ps(src + i * 2);
+        __m128 sq = _mm_mul_ps(v, v);
+        __m128 length = _mm_sqrt_ps(_mm_add_ps(sq, _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(2, 3, 0, 1))));
+        __m128 ilength = _mm_div_ps(one, length);
+        __m128 valid = _mm_cmpgt_ps(length, zero);
+        _mm_storeu_ps(dst + i * 2, _mm_and_ps(valid, _mm_mul_ps(v, ilength)));
+    }
+#endif
+
+    for (; i < count; i++)
+        out[i] = Normalize(in[i]);
+}
+
+// Normalize count vectors with NormalizeFast(), same error bounds
+RMAPI void NormalizeFastN(Vector2* out, const Vector2* in, size_t count)
+{
+    size_t i = 0;
+
+#if MATH_SIMD_WIDTH >= 4
+    const float* src = &in[0].x;
+    float* dst = &out[0].x;
+#endif
+
+#if MATH_SIMD_WIDTH == 8
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 threeHalves = _mm256_set1_ps(1.5f);
+    const __m256 zero = _mm256_setzero_ps();
+    for (; i + 4 <= count; i += 4)
+    {
+        __m256 v = _mm256_loadu_ps(src + i * 2);
+        __m256 sq = _mm256_mul_ps(v, v);
+        __m256 lengthSqr = _mm256_add_ps(sq, _mm256_permute_ps(sq, _MM_SHUFFLE(2, 3, 0, 1)));
+        __m256 y = _mm256_rsqrt_ps(lengthSqr);
+        y = _mm256_mul_ps(y, _mm256_sub_ps(threeHalves, _mm256_mul_ps(_mm256_mul_ps(half, lengthSqr), _mm256_mul_ps(y, y))));
+        __m256 valid = _mm256_cmp_ps(lengthSqr, zero, _CMP_GT_OQ);
+        _mm256_storeu_ps(dst + i * 2, _mm256_and_ps(valid, _mm256_mul_ps(v, y)));
+    }
+#elif MATH_SIMD_WIDTH == 4
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 threeHalves = _mm_set1_ps(1.5f);
+    const __m128 zero = _mm_setzero_ps();
+    for (; i + 2 <= count; i += 2)
+    {
+        __m128 v = _mm_loadu_ps(src + i * 2);
+        __m128 sq = _mm_mul_ps(v, v);
+        __m128 lengthSqr = _mm_add_ps(sq, _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(2, 3, 0, 1)));
+        __m128 y = _mm_rsqrt_ps(lengthSqr);
+        y = _mm_mul_ps(y, _mm_sub_ps(threeHalves, _mm_mul_ps(_mm_mul_ps(half, lengthSqr), _mm_mul_ps(y, y))));
+        __m128 valid = _mm_cmpgt_ps(lengthSqr, zero);
+        _mm_storeu_ps(dst + i * 2, _mm_and_ps(valid, _mm_mul_ps(v, y)));
+    }
+#endif
+
+    for (; i < count; i++)
+        out[i] = NormalizeFast(in[i]);
+}
+
+// Square distance from point to count points given as separate x & y arrays
+RMAPI void DistanceSqrN(float* out, const float* xs, const float* ys, size_t count, Vector2 point)
+{
+    size_t i = 0;
+
+#if MATH_SIMD_WIDTH == 8
+    const __m256 px = _mm256_set1_ps(point.x);
+    const __m256 py = _mm256_set1_ps(point.y);
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 dx = _mm256_sub_ps(px, _mm256_loadu_ps(xs + i));
+        __m256 dy = _mm256_sub_ps(py, _mm256_loadu_ps(ys + i));
+        _mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)));
+    }
+#elif MATH_SIMD_WIDTH == 4
+    const __m128 px = _mm_set1_ps(point.x);
+    const __m128 py = _mm_set1_ps(point.y);
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 dx = _mm_sub_ps(px, _mm_loadu_ps(xs + i));
+        __m128 dy = _mm_sub_ps(py, _mm_loadu_ps(ys + i));
+        _mm_storeu_ps(out + i, _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)));
+    }
+#endif
+
+    for (; i < count; i++)
+        out[i] = DistanceSqr(point, Vector2{ xs[i], ys[i] });
+}
+
+// Square distance from point to count points
+RMAPI void DistanceSqrN(float* out, const Vector2* points, size_t count, Vector2 point)
+{
+    size_t i = 0;
+
+#if MATH_SIMD_WIDTH >= 4
+    const float* src = &points[0].x;
+
+    // Interleaved input, 4 points per pair of loads, then split the squares into x & y halves
+    const __m128 p = _mm_setr_ps(point.x, point.y, point.x, point.y);
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 d0 = _mm_sub_ps(p, _mm_loadu_ps(src + i * 2));
+        __m128 d1 = _mm_sub_ps(p, _mm_loadu_ps(src + i * 2 + 4));
+        d0 = _mm_mul_ps(d0, d0);
+        d1 = _mm_mul_ps(d1, d1);
+        __m128 x = _mm_shuffle_ps(d0, d1, _MM_SHUFFLE(2, 0, 2, 0));
+        __m128 y = _mm_shuffle_ps(d0, d1, _MM_SHUFFLE(3, 1, 3, 1));
+        _mm_storeu_ps(out + i, _mm_add_ps(x, y));
+    }
+#endif
+
+    for (; i < count; i++)
+        out[i] = DistanceSqr(point, points[i]);
+}
+
+// out = a + b * scale for count floats (ie position += velocity * dt)
+RMAPI void MultiplyAddN(float* out, const float* a, const float* b, float scale, size_t count)
+{
+    size_t i = 0;
+
+#if MATH_SIMD_WIDTH == 8
+    const __m256 s = _mm256_set1_ps(scale);
+    for (; i + 8 <= count; i += 8)
+        _mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_loadu_ps(a + i), _mm256_mul_ps(_mm256_loadu_ps(b + i), s)));
+#elif MATH_SIMD_WIDTH == 4
+    const __m128 s = _mm_set1_ps(scale);
+    for (; i + 4 <= count; i += 4)
+        _mm_storeu_ps(out + i, _mm_add_ps(_mm_loadu_ps(a + i), _mm_mul_ps(_mm_loadu_ps(b + i), s)));
+#endif
+
+    for (; i < count; i++)
+        out[i] = a[i] + b[i] * scale;
+}
+
+// out = a + b * scale for count vectors
+RMAPI void MultiplyAddN(Vector2* out, const Vector2* a, const Vector2* b, float scale, size_t count)
+{
+    MultiplyAddN(&out[0].x, &a[0].x, &b[0].x, scale, count * 2);
+}
+
+// Sets bit i of mask (32 per word) if circle i overlaps the circle at center, clears it otherwise.
+// mask must hold (count + 31) / 32 words, unused bits of the last word are cleared.
+RMAPI void CircleOverlapMaskN(uint32_t* mask, const float* xs, const float* ys, const float* radii, size_t count, Vector2 center, float radius)
+{
+    for (size_t word = 0; word * 32 < count; word++)
+    {
+        const size_t start = word * 32;
+        const size_t end = count - start < 32 ? count : start + 32;
+        uint32_t bits = 0;
+        size_t i = start;
+
+#if MATH_SIMD_WIDTH == 8
+        const __m256 cx = _mm256_set1_ps(center.x);
+        const __m256 cy = _mm256_set1_ps(center.y);
+        const __m256 r = _mm256_set1_ps(radius);
+        for (; i + 8 <= end; i += 8)
+        {
+            __m256 dx = _mm256_sub_ps(cx, _mm256_loadu_ps(xs + i));
+            __m256 dy = _mm256_sub_ps(cy, _mm256_loadu_ps(ys + i));
+            __m256 sum = _mm256_add_ps(r, _mm256_loadu_ps(radii + i));
+            __m256 overlap = _mm256_cmp_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)), _mm256_mul_ps(sum, sum), _CMP_LE_OQ);
+            bits |= (uint32_t)_mm256_movemask_ps(overlap) << (i - start);
+        }
+#elif MATH_SIMD_WIDTH == 4
+        const __m128 cx = _mm_set1_ps(center.x);
+        const __m128 cy = _mm_set1_ps(center.y);
+        const __m128 r = _mm_set1_ps(radius);
+        for (; i + 4 <= end; i += 4)
+        {
+            __m128 dx = _mm_sub_ps(cx, _mm_loadu_ps(xs + i));
+            __m128 dy = _mm_sub_ps(cy, _mm_loadu_ps(ys + i));
+            __m128 sum = _mm_add_ps(r, _mm_loadu_ps(radii + i));
+            __m128 overlap = _mm_cmple_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(sum, sum));
+            bits |= (uint32_t)_mm_movemask_ps(overlap) << (i - start);
+        }
+#endif
+
+        for (; i < end; i++)
+        {
+            float sum = radius + radii[i];
+            if (DistanceSqr(center, Vector2{ xs[i], ys[i] }) <= sum * sum)
+                bits |= 1u << (i - start);
+        }
+
+        mask[word] = bits;
+    }
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Vector3 math
 //----------------------------------------------------------------------------------
@@ -1128,8 +1591,38 @@ RMAPI float Trace(Matrix mat)
     return result;
 }
 
-// Transposes provided matrix
-RMAPI Matrix Transpose(Matrix mat)
+#if MATH_SIMD_MATRIX
+// Loads the matrix as stored, ie rows[0] = { m0, m4, m8, m12 }
+RMAPI void LoadMatrixRows(const Matrix& mat, __m128 rows[4])
+{
+    const float* src = (const float*)&mat;
+    rows[0] = _mm_loadu_ps(src);
+    rows[1] = _mm_loadu_ps(src + 4);
+    rows[2] = _mm_loadu_ps(src + 8);
+    rows[3] = _mm_loadu_ps(src + 12);
+}
+
+RMAPI Matrix StoreMatrixRows(const __m128 rows[4])
+{
+    Matrix result;
+    float* dst = (float*)&result;
+    _mm_storeu_ps(dst, rows[0]);
+    _mm_storeu_ps(dst + 4, rows[1]);
+    _mm_storeu_ps(dst + 8, rows[2]);
+    _mm_storeu_ps(dst + 12, rows[3]);
+    return result;
+}
+
+// { v[X], v[Y], v[Z], v[W] }
+template<int X, int Y, int Z, int W>
+RMAPI __m128 Swizzle(__m128 v)
+{
+    return _mm_shuffle_ps(v, v, _MM_SHUFFLE(W, Z, Y, X));
+}
+#endif
+
+// Transposes provided matrix (scalar reference for Transpose())
+RMAPI Matrix TransposeScalar(Matrix mat)
 {
     Matrix result = { 0 };
 
@@ -1153,8 +1646,21 @@ RMAPI Matrix Transpose(Matrix mat)
     return result;
 }
 
-// Invert provided matrix
-RMAPI Matrix Invert(Matrix mat)
+// Transposes provided matrix
+RMAPI Matrix Transpose(Matrix mat)
+{
+#if MATH_SIMD_MATRIX
+    __m128 rows[4];
+    LoadMatrixRows(mat, rows);
+    _MM_TRANSPOSE4_PS(rows[0], rows[1], rows[2], rows[3]);
+    return StoreMatrixRows(rows);
+#else
+    return TransposeScalar(mat);
+#endif
+}
+
+// Invert provided matrix (scalar reference for Invert())
+RMAPI Matrix InvertScalar(Matrix mat)
 {
     Matrix result = { 0 };
 
@@ -1200,6 +1706,65 @@ RMAPI Matrix Invert(Matrix mat)
     return result;
 }
 
+#if MATH_SIMD_MATRIX
+// One stored row of the inverse (before scaling by 1/det) from a row of a & 3 vectors of
+// 2x2 determinants, same products & summation order as InvertScalar()
+RMAPI __m128 InvertRow(__m128 a, __m128 b1, __m128 b2, __m128 b3, __m128 signFirst, __m128 signSecond)
+{
+    __m128 t1 = _mm_xor_ps(_mm_mul_ps(Swizzle<1, 0, 0, 0>(a), b1), signFirst);
+    __m128 t2 = _mm_xor_ps(_mm_mul_ps(Swizzle<2, 2, 1, 1>(a), b2), signSecond);
+    __m128 t3 = _mm_xor_ps(_mm_mul_ps(Swizzle<3, 3, 3, 2>(a), b3), signFirst);
+    return _mm_add_ps(_mm_add_ps(t1, t2), t3);
+}
+
+// 2x2 determinants x[p]*y[q] - x[q]*y[p] for the pairs InvertRow() needs
+RMAPI void InvertPairs(__m128 x, __m128 y, __m128 out[3])
+{
+    out[0] = _mm_sub_ps(_mm_mul_ps(Swizzle<2, 2, 1, 1>(x), Swizzle<3, 3, 3, 2>(y)), _mm_mul_ps(Swizzle<3, 3, 3, 2>(x), Swizzle<2, 2, 1, 1>(y)));
+    out[1] = _mm_sub_ps(_mm_mul_ps(Swizzle<1, 0, 0, 0>(x), Swizzle<3, 3, 3, 2>(y)), _mm_mul_ps(Swizzle<3, 3, 3, 2>(x), Swizzle<1, 0, 0, 0>(y)));
+    out[2] = _mm_sub_ps(_mm_mul_ps(Swizzle<1, 0, 0, 0>(x), Swizzle<2, 2, 1, 1>(y)), _mm_mul_ps(Swizzle<2, 2, 1, 1>(x), Swizzle<1, 0, 0, 0>(y)));
+}
+#endif
+
+// Invert provided matrix
+RMAPI Matrix Invert(Matrix mat)
+{
+#if MATH_SIMD_MATRIX
+    // a (InvertScalar() naming) is the transpose of the stored rows
+    __m128 a[4];
+    LoadMatrixRows(mat, a);
+    _MM_TRANSPOSE4_PS(a[0], a[1], a[2], a[3]);
+
+    // low = { b05, b05, b04, b03 }, { b04, b02, b02, b01 }, { b03, b01, b00, b00 }
+    // high = the same with b06..b11
+    __m128 low[3], high[3];
+    InvertPairs(a[0], a[1], low);
+    InvertPairs(a[2], a[3], high);
+
+    float l[3][4], h[3][4];
+    for (int i = 0; i < 3; i++)
+    {
+        _mm_storeu_ps(l[i], low[i]);
+        _mm_storeu_ps(h[i], high[i]);
+    }
+    float b00 = l[2][2], b01 = l[1][3], b02 = l[1][1], b03 = l[2][0], b04 = l[1][0], b05 = l[0][0];
+    float b06 = h[2][2], b07 = h[1][3], b08 = h[1][1], b09 = h[2][0], b10 = h[1][0], b11 = h[0][0];
+    __m128 invDet = _mm_set1_ps(1.0f / (b00 * b11 - b01 * b10 + b02 * b09 + b03 * b08 - b04 * b07 + b05 * b06));
+
+    const __m128 plusMinus = _mm_set_ps(-0.0f, 0.0f, -0.0f, 0.0f);
+    const __m128 minusPlus = _mm_set_ps(0.0f, -0.0f, 0.0f, -0.0f);
+
+    __m128 rows[4];
+    rows[0] = _mm_mul_ps(InvertRow(a[1], high[0], high[1], high[2], plusMinus, minusPlus), invDet);
+    rows[1] = _mm_mul_ps(InvertRow(a[0], high[0], high[1], high[2], minusPlus, plusMinus), invDet);
+    rows[2] = _mm_mul_ps(InvertRow(a[3], low[0], low[1], low[2], plusMinus, minusPlus), invDet);
+    rows[3] = _mm_mul_ps(InvertRow(a[2], low[0], low[1], low[2], minusPlus, plusMinus), invDet);
+    return StoreMatrixRows(rows);
+#else
+    return InvertScalar(mat);
+#endif
+}
+
 // Get identity matrix
 RMAPI Matrix MatrixIdentity(void)
 {
@@ -1263,6 +1828,8 @@ RMAPI Matrix Subtract(Matrix left, Matrix right)
 
 // Get two matrix multiplication
 // NOTE: When multiplying matrices... the order matters!
+// No SSE version, the compilers vectorize this on their own and hand written SSE measured no faster
+// (slower in AVX builds)
 RMAPI Matrix Multiply(Matrix left, Matrix right)
 {
     Matrix result = { 0 };
@@ -1815,6 +2382,7 @@ RMAPI Quaternion Nlerp(Quaternion q1, Quaternion q2, float amount)
 }
 
 // Calculates spherical linear interpolation between two quaternions
+// NOTE: No SSE version, the time goes into acosf/sinf and blending the components in SSE measured slower
 RMAPI Quaternion Slerp(Quaternion q1, Quaternion q2, float amount)
 {
     Quaternion result = { 0 };
@@ -2110,8 +2678,8 @@ RMAPI Vector3 ToEuler(Quaternion q)
     return result;
 }
 
-// Transform a quaternion given a transformation matrix
-RMAPI Quaternion Multiply(Quaternion q, Matrix mat)
+// Transform a quaternion given a transformation matrix (scalar reference for Multiply())
+RMAPI Quaternion MultiplyScalar(Quaternion q, Matrix mat)
 {
     Quaternion result = { 0 };
 
@@ -2123,6 +2691,28 @@ RMAPI Quaternion Multiply(Quaternion q, Matrix mat)
     return result;
 }
 
+// Transform a quaternion given a transformation matrix
+RMAPI Quaternion Multiply(Quaternion q, Matrix mat)
+{
+#if MATH_SIMD_MATRIX
+    // Columns of the stored rows, weighted by the components
+    __m128 rows[4];
+    LoadMatrixRows(mat, rows);
+    _MM_TRANSPOSE4_PS(rows[0], rows[1], rows[2], rows[3]);
+
+    __m128 sum = _mm_mul_ps(rows[0], _mm_set1_ps(q.x));
+    sum = _mm_add_ps(sum, _mm_mul_ps(rows[1], _mm_set1_ps(q.y)));
+    sum = _mm_add_ps(sum, _mm_mul_ps(rows[2], _mm_set1_ps(q.z)));
+    sum = _mm_add_ps(sum, _mm_mul_ps(rows[3], _mm_set1_ps(q.w)));
+
+    Quaternion result;
+    _mm_storeu_ps(&result.x, sum);
+    return result;
+#else
+    return MultiplyScalar(q, mat);
+#endif
+}
+
 // Check whether two given quaternions are almost equal
 RMAPI int Equals(Quaternion p, Quaternion q)
 {
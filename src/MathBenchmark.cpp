@@ -0,0 +1,339 @@
+// Benchmark suite for the Math.h hot paths, run it before & after any change to the math layer.
+// Usage: mathbench [--batch=N[,N...]] [--filter=text] [--min-time=seconds] [--csv]
+//  --batch     items each function is run over per timed call, one table per size (default 4096)
+//              small batches stay in L1, large ones show the memory bound throughput
+//  --filter    only run benchmarks whose name contains text, ie --filter=Matrix
+//  --min-time  how long each of the 5 timed runs should take (default 0.02s)
+//  --csv       name,batch,ns/op,items/s lines instead of the table, to diff between builds
+// Only times things, mathcheck (MathCheck.cpp) is what checks the SIMD paths against the scalar ones.
+//
+// Header-only, no raylib needed:
+//   g++ -O2 -std=c++17 src/MathBenchmark.cpp -o mathbench          (SSE2 paths)
+//   g++ -O2 -std=c++17 -mavx src/MathBenchmark.cpp -o mathbench    (AVX paths)
+#include "Math.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Inputs & outputs shared by every benchmark, refilled for each batch size
+struct BenchmarkData
+{
+    std::vector<Vector2> a, b;
+    std::vector<float> xs, ys, radii, scalars;
+    std::vector<Matrix> m1, m2;
+    std::vector<Quaternion> q1, q2;
+
+    std::vector<Vector2> outVectors;
+    std::vector<float> outFloats;
+    std::vector<Matrix> outMatrices;
+    std::vector<Quaternion> outQuaternions;
+    std::vector<uint32_t> outMask;
+};
+
+struct Benchmark
+{
+    const char* name;
+    void (*run)(BenchmarkData& data, size_t count);
+    double (*error)(const BenchmarkData& data, size_t count);  // optional, reported next to the timing
+};
+
+// Written after every run so the optimizer can't drop the work
+static volatile float sink = 0.0f;
+
+// Best of several timed runs, each repeating fn until it takes at least minTime
+template<typename Fn>
+static double NanosecondsPerOp(size_t opsPerCall, double minTime, Fn&& fn)
+{
+    using Clock = std::chrono::steady_clock;
+
+    size_t calls = 1;
+    for (;;)
+    {
+        auto start = Clock::now();
+        for (size_t i = 0; i < calls; i++)
+            fn();
+        if (std::chrono::duration<double>(Clock::now() - start).count() > minTime)
+            break;
+        calls *= 2;
+    }
+
+    double best = 1e30;
+    for (int run = 0; run < 5; run++)
+    {
+        auto start = Clock::now();
+        for (size_t i = 0; i < calls; i++)
+            fn();
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        double ns = seconds * 1e9 / (double)(calls * opsPerCall);
+        if (ns < best)
+            best = ns;
+    }
+    return best;
+}
+
+// Worst deviation of the result lengths from 1, zero vectors skipped
+static double NormalizeError(const BenchmarkData& data, size_t count)
+{
+    double worst = 0.0;
+    for (size_t i = 0; i < count; i++)
+    {
+        if (data.a[i].x == 0.0f && data.a[i].y == 0.0f)
+            continue;
+        Vector2 v = data.outVectors[i];
+        double error = fabs(sqrt((double)v.x * v.x + (double)v.y * v.y) - 1.0);
+        if (error > worst)
+            worst = error;
+    }
+    return worst;
+}
+
+static const Benchmark BENCHMARKS[] =
+{
+    // Vector2, one call per item
+    { "Add(Vector2)", [](BenchmarkData& d, size_t n) {
+        for (size_t i = 0; i < n; i++) d.outVectors[i] = Add(d.a[i], d.b[i]);
+    } },
+    { "Subtract(Vector2)", [](BenchmarkData& d, size_t n) {
+        for (size_t i = 0; i < n; i++) d.outVectors[i] = Subtract(d.a[i], d.b[i]);
+    } },
+    { "Scale(Vector2)", [](BenchmarkData& d, size_t n) {
+        for (size_t i = 0; i < n; i++) d.outVectors[i] = Scale(d.a[i], d.scalars[i]);
+    } },
+    { "Lerp(Vector2)", [](BenchmarkData& d, size_t n) {
+        for (size_t i = 0; i < n; i++) d.outVectors[i] = Lerp(d.a[i], d.b[i], d.scalars[i]);
+    } },
+    { "Dot(Vector2)", [](BenchmarkData& d, size_t n) {
+        for (size_t i = 0; i < n; i++) d.outFloats[i] = Dot(d.a[i], d.b[i]);
+    } },
+    { "Length(Vector2)", [](BenchmarkData& d, size_t n) {
+        for (size_t i = 0; i < n; i++) d.outFloats[i] = Length(d.a[i]);
+    } },
+    { "Normalize(Vector2)", [](BenchmarkData& d, size_t n) {
+        for (size_t i = 0; i < n; i++) d.outVectors[i] = Normalize(d.a[i]);
+    }, NormalizeError },
+    { "NormalizeFast(Vector2)", [](BenchmarkData& d, size_t n) {
+        for (size_t i = 0; i < n; i++) d.outVectors[i] = NormalizeFast(d.a[i]);
+    }, NormalizeError },
+    { "Distance(Vector2)", [](BenchmarkData& d, size_t n) {
+        for (size_t i = 0; i < n; i++) d.outFloats[i] = Distance(d.a[i], d.b[i]);
+    } },
+    { "DistanceSqr(Vector2)", [](BenchmarkData& d, size_t n) {
+        for (size_t i = 0; i < n; i++) d.outFloats[i] = DistanceSqr(d.a[i], d.b[i]);
+    } },
+    { "Rotate(Vector2)", [](BenchmarkData& d, size_t n) {
+        for (size_t i = 0; i < n; i++) d.outVectors[i] = Rotate(d.a[i], d.scalars[i]);
+    } },
+    { "MoveTowards(Vector2)", [](BenchmarkData& d, size_t n) {
+        for (size_t i = 0; i < n; i++) d.outVectors[i] = MoveTowards(d.a[i], d.b[i], d.scalars[i]);
+    } },
+    { "Multiply(Vector2, Matrix)", [](BenchmarkData& d, size_t n) {
+        for (size_t i = 0; i < n; i++) d.outVectors[i] = Multiply(d.a[i], d.m1[0]);
+    } },
+
+    // Vector2 batches
+    { "NormalizeN", [](BenchmarkData& d, size_t n) {
+        NormalizeN(d.outVectors.data(), d.a.data(), n);
+    }, NormalizeError },
+    { "NormalizeFastN", [](BenchmarkData& d, size_t n) {
+        NormalizeFastN(d.outVectors.data(), d.a.data(), n);
+    }, NormalizeError },
+    { "DistanceSqrN(SoA)", [](BenchmarkData& d, size_t n) {
+        DistanceSqrN(d.outFloats.data(), d.xs.data(), d.ys.data(), n, d.b[0]);
+    } },
+    { "DistanceSqrN(AoS)", [](BenchmarkData& d, size_t n) {
+        DistanceSqrN(d.outFloats.data(), d.a.data(), n, d.b[0]);
+    } },
+    { "MultiplyAddN(Vector2)", [](BenchmarkData& d, size_t n) {
+        MultiplyAddN(d.outVectors.data(), d.a.data(), d.b.data(), 0.016f, n);
+    } },
+    { "CircleOverlapMaskN", [](BenchmarkData& d, size_t n) {
+        CircleOverlapMaskN(d.outMask.data(), d.xs.data(), d.ys.data(), d.radii.data(), n, d.b[0], 50.0f);
+    } },
+
+    // Matrix
+    { "Multiply(Matrix)", [](BenchmarkData& d, size_t n) {
+        for (size_t i = 0; i < n; i++) d.outMatrices[i] = Multiply(d.m1[i], d.m2[i]);
+    } },
+    { "Invert(Matrix)", [](BenchmarkData& d, size_t n) {
+        for (size_t i = 0; i < n; i++) d.outMatrices[i] = Invert(d.m1[i]);
+    } },
+    { "InvertScalar(Matrix)", [](BenchmarkData& d, size_t n) {
+        for (size_t i = 0; i < n; i++) d.outMatrices[i] = InvertScalar(d.m1[i]);
+    } },
+    { "Transpose(Matrix)", [](BenchmarkData& d, size_t n) {
+        for (size_t i = 0; i < n; i++) d.outMatrices[i] = Transpose(d.m1[i]);
+    } },
+    { "TransposeScalar(Matrix)", [](BenchmarkData& d, size_t n) {
+        for (size_t i = 0; i < n; i++) d.outMatrices[i] = TransposeScalar(d.m1[i]);
+    } },
+    { "Determinant(Matrix)", [](BenchmarkData& d, size_t n) {
+        for (size_t i = 0; i < n; i++) d.outFloats[i] = Determinant(d.m1[i]);
+    } },
+
+    // Quaternion
+    { "Multiply(Quaternion, Matrix)", [](BenchmarkData& d, size_t n) {
+        for (size_t i = 0; i < n; i++) d.outQuaternions[i] = Multiply(d.q1[i], d.m1[i]);
+    } },
+    { "MultiplyScalar(Quaternion, Matrix)", [](BenchmarkData& d, size_t n) {
+        for (size_t i = 0; i < n; i++) d.outQuaternions[i] = MultiplyScalar(d.q1[i], d.m1[i]);
+    } },
+    { "Slerp", [](BenchmarkData& d, size_t n) {
+        for (size_t i = 0; i < n; i++) d.outQuaternions[i] = Slerp(d.q1[i], d.q2[i], d.scalars[i]);
+    } },
+    { "Nlerp", [](BenchmarkData& d, size_t n) {
+        for (size_t i = 0; i < n; i++) d.outQuaternions[i] = Nlerp(d.q1[i], d.q2[i], d.scalars[i]);
+    } },
+};
+
+// Well conditioned, so Invert() differences come from the arithmetic and not the input
+static Matrix RandomMatrix(RandomState* random)
+{
+    Matrix result;
+    float* m = (float*)&result;
+    for (int i = 0; i < 16; i++)
+        m[i] = Random(random, -1.0f, 1.0f);
+    result.m0 += 4.0f;
+    result.m5 += 4.0f;
+    result.m10 += 4.0f;
+    result.m15 += 4.0f;
+    return result;
+}
+
+static Quaternion RandomRotation(RandomState* random)
+{
+    Vector3 axis = { Random(random, -1.0f, 1.0f), Random(random, -1.0f, 1.0f), Random(random, -1.0f, 1.0f) };
+    return FromAxisAngle(axis, Random(random, -PI, PI));
+}
+
+static void FillData(BenchmarkData& data, size_t count)
+{
+    RandomState random = RandomSeed(1);
+
+    data.a.resize(count);
+    data.b.resize(count);
+    data.xs.resize(count);
+    data.ys.resize(count);
+    data.radii.resize(count);
+    data.scalars.resize(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        // Lengths spread over several orders of magnitude, like positions & velocities in game units
+        float scale = powf(10.0f, Random(&random, -3.0f, 4.0f));
+        data.a[i] = { Random(&random, -1.0f, 1.0f) * scale, Random(&random, -1.0f, 1.0f) * scale };
+        data.b[i] = { Random(&random, 0.0f, 1280.0f), Random(&random, 0.0f, 720.0f) };
+        data.xs[i] = data.a[i].x;
+        data.ys[i] = data.a[i].y;
+        data.radii[i] = Random(&random, 5.0f, 40.0f);
+        data.scalars[i] = Random(&random, 0.0f, 1.0f);
+    }
+
+    data.m1.resize(count);
+    data.m2.resize(count);
+    data.q1.resize(count);
+    data.q2.resize(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        data.m1[i] = RandomMatrix(&random);
+        data.m2[i] = RandomMatrix(&random);
+        data.q1[i] = RandomRotation(&random);
+        data.q2[i] = RandomRotation(&random);
+    }
+
+    data.outVectors.assign(count, Vector2{});
+    data.outFloats.assign(count, 0.0f);
+    data.outMatrices.assign(count, Matrix{});
+    data.outQuaternions.assign(count, Quaternion{});
+    data.outMask.assign((count + 31) / 32, 0);
+}
+
+static void PrintUsage(const char* program)
+{
+    printf("Usage: %s [--batch=N[,N...]] [--filter=text] [--min-time=seconds] [--csv]\n", program);
+}
+
+int main(int argc, char** argv)
+{
+    std::vector<size_t> batches;
+    std::string filter;
+    double minTime = 0.02;
+    bool csv = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char* arg = argv[i];
+        if (strncmp(arg, "--batch=", 8) == 0)
+        {
+            for (const char* p = arg + 8; *p != '\0';)
+            {
+                char* end = nullptr;
+                long long batch = strtoll(p, &end, 10);
+                if (end == p || batch <= 0 || (*end != ',' && *end != '\0'))
+                {
+                    PrintUsage(argv[0]);
+                    return 1;
+                }
+                batches.push_back((size_t)batch);
+                p = *end == ',' ? end + 1 : end;
+            }
+        }
+        else if (strncmp(arg, "--filter=", 9) == 0)
+            filter = arg + 9;
+        else if (strncmp(arg, "--min-time=", 11) == 0 && atof(arg + 11) > 0.0)
+            minTime = atof(arg + 11);
+        else if (strcmp(arg, "--csv") == 0)
+            csv = true;
+        else
+        {
+            PrintUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (batches.empty())
+        batches.push_back(4096);
+
+    if (csv)
+        printf("name,batch,ns_per_op,items_per_second\n");
+    else
+        printf("\nSIMD width: %d, min time: %gs\n", MATH_SIMD_WIDTH, minTime);
+
+    BenchmarkData data;
+    for (size_t batch : batches)
+    {
+        FillData(data, batch);
+
+        if (!csv)
+        {
+            printf("\n%-40s %12s %14s\n", "Benchmark", "Time", "Items/s");
+            printf("--------------------------------------------------------------------\n");
+        }
+
+        for (const Benchmark& benchmark : BENCHMARKS)
+        {
+            if (!filter.empty() && strstr(benchmark.name, filter.c_str()) == nullptr)
+                continue;
+
+            double ns = NanosecondsPerOp(batch, minTime, [&] {
+                benchmark.run(data, batch);
+                sink = data.outFloats[0] + data.outVectors[0].x + data.outMatrices[0].m0 + data.outQuaternions[0].x;
+            });
+
+            if (csv)
+            {
+                printf("\"%s\",%zu,%.4f,%.0f\n", benchmark.name, batch, ns, 1e9 / ns);
+                continue;
+            }
+
+            std::string name = std::string(benchmark.name) + "/" + std::to_string(batch);
+            printf("%-40s %9.3f ns %11.1f M/s", name.c_str(), ns, 1e3 / ns);
+            if (benchmark.error != nullptr)
+                printf("   max error %.2e", benchmark.error(data, batch));
+            printf("\n");
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,225 @@
+// Correctness check for the Math.h SIMD paths, run it after any change to the math layer.
+// Usage: mathcheck
+// Compares every SIMD matrix/quaternion function against its *Scalar version over random inputs, and
+// every Vector2 batch function against its scalar version in a loop over every count from 0 to 99 (so
+// all the odd tails get hit) with zero vectors mixed in. Exits with 1 if anything disagrees.
+// mathbench only times things, this is what says they're right.
+//
+// Header-only, no raylib needed:
+//   g++ -O2 -std=c++17 src/MathCheck.cpp -o mathcheck          (SSE2 paths)
+//   g++ -O2 -std=c++17 -mavx src/MathCheck.cpp -o mathcheck    (AVX paths)
+#include "Math.h"
+
+#include <cstdio>
+#include <vector>
+
+// Worst component difference relative to the reference, or the magnitude of the value
+// for components near 0
+static float RelativeError(const float* value, const float* reference, int count)
+{
+    float worst = 0.0f;
+    for (int i = 0; i < count; i++)
+    {
+        float error = fabsf(value[i] - reference[i]) / fmaxf(1.0f, fabsf(reference[i]));
+        if (!(error <= worst))
+            worst = error;
+    }
+    return worst;
+}
+
+// Well conditioned, so Invert() differences come from the arithmetic and not the input
+static Matrix RandomMatrix(RandomState* random)
+{
+    Matrix result;
+    float* m = (float*)&result;
+    for (int i = 0; i < 16; i++)
+        m[i] = Random(random, -1.0f, 1.0f);
+    result.m0 += 4.0f;
+    result.m5 += 4.0f;
+    result.m10 += 4.0f;
+    result.m15 += 4.0f;
+    return result;
+}
+
+static Quaternion RandomRotation(RandomState* random)
+{
+    Vector3 axis = { Random(random, -1.0f, 1.0f), Random(random, -1.0f, 1.0f), Random(random, -1.0f, 1.0f) };
+    return FromAxisAngle(axis, Random(random, -PI, PI));
+}
+
+struct CheckResult
+{
+    const char* name;
+    float error;
+};
+
+// Returns false if any result is over tolerance, printing every result either way
+static bool Report(const CheckResult* results, int count, float tolerance)
+{
+    bool passed = true;
+    for (int i = 0; i < count; i++)
+    {
+        bool ok = results[i].error <= tolerance;
+        printf("  %-30s max error %.2e  %s\n", results[i].name, results[i].error, ok ? "ok" : "FAILED");
+        passed = passed && ok;
+    }
+    return passed;
+}
+
+// Returns false if any SIMD function strays from its scalar reference.
+// Without FMA contraction the results are bit-exact, the tolerance leaves room for compilers that fuse
+// the scalar code.
+static bool CheckMatrixBackend()
+{
+    const int iterations = 100000;
+    const float tolerance = 1e-5f;
+
+    RandomState random = RandomSeed(2);
+    float invertError = 0.0f, transposeError = 0.0f, transformError = 0.0f;
+    for (int i = 0; i < iterations; i++)
+    {
+        Matrix a = RandomMatrix(&random);
+
+        Matrix value = Invert(a);
+        Matrix reference = InvertScalar(a);
+        invertError = fmaxf(invertError, RelativeError((float*)&value, (float*)&reference, 16));
+
+        value = Transpose(a);
+        reference = TransposeScalar(a);
+        transposeError = fmaxf(transposeError, RelativeError((float*)&value, (float*)&reference, 16));
+
+        Quaternion q = RandomRotation(&random);
+        Quaternion transformed = Multiply(q, a);
+        Quaternion transformedReference = MultiplyScalar(q, a);
+        transformError = fmaxf(transformError, RelativeError(&transformed.x, &transformedReference.x, 4));
+    }
+
+    CheckResult results[] =
+    {
+        { "Invert(Matrix)", invertError },
+        { "Transpose(Matrix)", transposeError },
+        { "Multiply(Quaternion, Matrix)", transformError },
+    };
+
+    printf("SIMD matrix backend: %s\n", MATH_SIMD_MATRIX ? "on" : "off");
+    return Report(results, sizeof(results) / sizeof(results[0]), tolerance);
+}
+
+// Worst relative error of the first count of size values, or infinity if anything past them differs
+static float BatchError(const float* value, const float* reference, size_t count, size_t size)
+{
+    for (size_t i = count; i < size; i++)
+    {
+        if (value[i] != reference[i])
+            return INFINITY;
+    }
+    return RelativeError(value, reference, (int)count);
+}
+
+// Returns false if any batch function strays from calling its scalar version in a loop.
+// Outputs are padded past count with the same values in both, so a SIMD path writing past the end
+// shows up too.
+static bool CheckBatchFunctions()
+{
+    const size_t maxCount = 100;
+    const size_t padding = 16;
+    const float tolerance = 1e-5f;
+
+    RandomState random = RandomSeed(3);
+    float normalizeError = 0.0f, normalizeFastError = 0.0f, distanceError = 0.0f, distancePointsError = 0.0f;
+    float multiplyAddError = 0.0f, overlapMismatches = 0.0f;
+    for (size_t count = 0; count < maxCount; count++)
+    {
+        // Every 5th vector zero, the rest with lengths over several orders of magnitude
+        std::vector<Vector2> a(count + padding), b(count + padding);
+        std::vector<float> xs(count + padding), ys(count + padding), radii(count + padding);
+        for (size_t i = 0; i < count + padding; i++)
+        {
+            float scale = i % 5 == 0 ? 0.0f : powf(10.0f, Random(&random, -3.0f, 4.0f));
+            a[i] = { Random(&random, -1.0f, 1.0f) * scale, Random(&random, -1.0f, 1.0f) * scale };
+            b[i] = { Random(&random, -100.0f, 100.0f), Random(&random, -100.0f, 100.0f) };
+            xs[i] = Random(&random, 0.0f, 200.0f);
+            ys[i] = Random(&random, 0.0f, 200.0f);
+            radii[i] = Random(&random, 5.0f, 40.0f);
+        }
+        Vector2 point = { Random(&random, 0.0f, 200.0f), Random(&random, 0.0f, 200.0f) };
+        float radius = Random(&random, 5.0f, 40.0f);
+        float scale = Random(&random, 0.0f, 0.1f);
+
+        // Vector2 results are compared as twice as many floats
+        std::vector<Vector2> vectors(count + padding, Vector2{ -1.0f, -1.0f });
+        std::vector<Vector2> vectorsReference(count + padding, Vector2{ -1.0f, -1.0f });
+        auto vectorError = [&]() {
+            return BatchError(&vectors[0].x, &vectorsReference[0].x, count * 2, (count + padding) * 2);
+        };
+
+        NormalizeN(vectors.data(), a.data(), count);
+        for (size_t i = 0; i < count; i++)
+            vectorsReference[i] = Normalize(a[i]);
+        normalizeError = fmaxf(normalizeError, vectorError());
+
+        NormalizeFastN(vectors.data(), a.data(), count);
+        for (size_t i = 0; i < count; i++)
+            vectorsReference[i] = NormalizeFast(a[i]);
+        normalizeFastError = fmaxf(normalizeFastError, vectorError());
+
+        MultiplyAddN(vectors.data(), a.data(), b.data(), scale, count);
+        for (size_t i = 0; i < count; i++)
+            vectorsReference[i] = { a[i].x + b[i].x * scale, a[i].y + b[i].y * scale };
+        multiplyAddError = fmaxf(multiplyAddError, vectorError());
+
+        std::vector<float> floats(count + padding, -1.0f);
+        std::vector<float> floatsReference(count + padding, -1.0f);
+
+        DistanceSqrN(floats.data(), xs.data(), ys.data(), count, point);
+        for (size_t i = 0; i < count; i++)
+            floatsReference[i] = DistanceSqr(point, Vector2{ xs[i], ys[i] });
+        distanceError = fmaxf(distanceError, BatchError(floats.data(), floatsReference.data(), count, count + padding));
+
+        DistanceSqrN(floats.data(), a.data(), count, point);
+        for (size_t i = 0; i < count; i++)
+            floatsReference[i] = DistanceSqr(point, a[i]);
+        distancePointsError = fmaxf(distancePointsError, BatchError(floats.data(), floatsReference.data(), count, count + padding));
+
+        // Every bit of the used words has to match, the unused ones of the last word must be clear
+        std::vector<uint32_t> mask((count + 31) / 32 + 1, 0xFFFFFFFFu);
+        CircleOverlapMaskN(mask.data(), xs.data(), ys.data(), radii.data(), count, point, radius);
+        for (size_t word = 0; word < mask.size(); word++)
+        {
+            uint32_t expected = 0xFFFFFFFFu;
+            if (word * 32 < count)
+            {
+                expected = 0;
+                for (size_t i = word * 32; i < count && i < word * 32 + 32; i++)
+                {
+                    float sum = radius + radii[i];
+                    if (DistanceSqr(point, Vector2{ xs[i], ys[i] }) <= sum * sum)
+                        expected |= 1u << (i - word * 32);
+                }
+            }
+            for (uint32_t off = mask[word] ^ expected; off != 0; off &= off - 1)
+                overlapMismatches += 1.0f;
+        }
+    }
+
+    CheckResult results[] =
+    {
+        { "NormalizeN", normalizeError },
+        { "NormalizeFastN", normalizeFastError },
+        { "DistanceSqrN(SoA)", distanceError },
+        { "DistanceSqrN(AoS)", distancePointsError },
+        { "MultiplyAddN(Vector2)", multiplyAddError },
+        { "CircleOverlapMaskN (bits off)", overlapMismatches },
+    };
+
+    printf("Batch functions, SIMD width %d, counts 0 to %d\n", MATH_SIMD_WIDTH, (int)maxCount - 1);
+    return Report(results, sizeof(results) / sizeof(results[0]), tolerance);
+}
+
+int main()
+{
+    bool passed = CheckMatrixBackend();
+    passed = CheckBatchFunctions() && passed;
+    printf(passed ? "All checks passed\n" : "Checks FAILED\n");
+    return passed ? 0 : 1;
+}
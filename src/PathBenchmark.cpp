@@ -0,0 +1,140 @@
+// Times FlowField::Repair() against rebuilding the whole field, one cell toggled at a time.
+// Usage: pathbench [size] [changes] (defaults to a 512x512 grid and 2000 changes)
+//
+// Every repaired field is checked against a fresh Build() of the same map, and every so often
+// ChunkedTileMap::FloodFill() is checked against the cells the field can reach (Build() is a BFS).
+// Exits with 1 on a mismatch.
+// Only needs raylib's headers, not the library:
+//   g++ -O2 -std=c++17 -Iinclude src/PathBenchmark.cpp -o pathbench
+#include "FlowField.h"
+#include "ChunkedTileMap.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+static double Microseconds(Clock::time_point start, Clock::time_point end)
+{
+    return std::chrono::duration<double, std::micro>(end - start).count();
+}
+
+static double Median(std::vector<double> values)
+{
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+
+static double Average(const std::vector<double>& values)
+{
+    double sum = 0.0;
+    for (double value : values)
+        sum += value;
+    return sum / values.size();
+}
+
+int main(int argc, char** argv)
+{
+    int size = argc > 1 ? atoi(argv[1]) : 512;
+    int changes = argc > 2 ? atoi(argv[2]) : 2000;
+    if (size < 2 || changes <= 0)
+    {
+        printf("Usage: %s [size] [changes]\n", argv[0]);
+        return 1;
+    }
+
+    // Roughly a quarter of the map blocked, goal in the middle
+    RandomState random = RandomSeed(1234);
+    std::vector<char> blocked(size * size);
+    for (char& cell : blocked)
+        cell = Random(&random, 0.0f, 1.0f) < 0.25f;
+    Cell goal = { size / 2, size / 2 };
+    blocked[goal.row * size + goal.col] = 0;
+
+    auto walkable = [&](int row, int col) { return !blocked[row * size + col]; };
+
+    // Same map as tiles for the flood fill, blocked cells are the zero-tiles it can't cross
+    ChunkedTileMap tiles(size, size, DIRT);
+    for (int row = 0; row < size; row++)
+    {
+        for (int col = 0; col < size; col++)
+            tiles.Set(row, col, blocked[row * size + col] ? GRASS : DIRT);
+    }
+    tiles.Compact();
+
+    FlowField repaired(size, size);
+    FlowField rebuilt(size, size);
+    repaired.Build(goal, walkable);
+
+    std::vector<double> repairTimes;
+    std::vector<double> buildTimes;
+    std::vector<double> floodTimes;
+    for (int i = 0; i < changes; i++)
+    {
+        Cell cell = { RandomInt(&random, 0, size - 1), RandomInt(&random, 0, size - 1) };
+        if (cell.row == goal.row && cell.col == goal.col)
+            continue;
+        blocked[cell.row * size + cell.col] ^= 1;
+        tiles.Set(cell.row, cell.col, blocked[cell.row * size + cell.col] ? GRASS : DIRT);
+
+        auto start = Clock::now();
+        repaired.Repair(cell, walkable);
+        auto end = Clock::now();
+        repairTimes.push_back(Microseconds(start, end));
+
+        start = Clock::now();
+        rebuilt.Build(goal, walkable);
+        end = Clock::now();
+        buildTimes.push_back(Microseconds(start, end));
+
+        for (int row = 0; row < size; row++)
+        {
+            for (int col = 0; col < size; col++)
+            {
+                if (repaired.Distance({ row, col }) != rebuilt.Distance({ row, col }))
+                {
+                    printf("Mismatch after change %d at (%d, %d): repaired %d, rebuilt %d\n", i, row, col,
+                        repaired.Distance({ row, col }), rebuilt.Distance({ row, col }));
+                    return 1;
+                }
+            }
+        }
+
+        if (i % 50 != 0)
+            continue;
+
+        start = Clock::now();
+        std::vector<Cell> flooded = tiles.FloodFill(goal, DIRT);
+        end = Clock::now();
+        floodTimes.push_back(Microseconds(start, end));
+
+        std::vector<char> reached(size * size);
+        for (Cell reachedCell : flooded)
+            reached[reachedCell.row * size + reachedCell.col]++;
+        for (int row = 0; row < size; row++)
+        {
+            for (int col = 0; col < size; col++)
+            {
+                if (reached[row * size + col] != (rebuilt.Reachable({ row, col }) ? 1 : 0))
+                {
+                    printf("Flood fill mismatch after change %d at (%d, %d): flooded %d times, %s\n", i, row, col,
+                        reached[row * size + col], rebuilt.Reachable({ row, col }) ? "reachable" : "unreachable");
+                    return 1;
+                }
+            }
+        }
+    }
+
+    printf("%dx%d grid, %d changes, all repairs match a full rebuild, %d flood fills match too\n", size, size,
+        (int)repairTimes.size(), (int)floodTimes.size());
+    printf("  %-8s %10s %10s\n", "", "avg us", "median us");
+    printf("  %-8s %10.2f %10.2f\n", "repair", Average(repairTimes), Median(repairTimes));
+    printf("  %-8s %10.2f %10.2f\n", "rebuild", Average(buildTimes), Median(buildTimes));
+    printf("  %-8s %10.2f %10.2f\n", "flood", Average(floodTimes), Median(floodTimes));
+    printf("  speedup  %9.1fx %9.1fx\n", Average(buildTimes) / Average(repairTimes),
+        Median(buildTimes) / Median(repairTimes));
+    return 0;
+}
@@ -0,0 +1,201 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Weak reference to a pooled object. Stays safe to hold after the object is removed,
+// lookups just fail once the slot's generation has moved on.
+struct Handle
+{
+    uint32_t index = UINT32_MAX;    // slot
+    uint32_t generation = 0;
+
+    bool operator==(const Handle& other) const { return index == other.index && generation == other.generation; }
+    bool operator!=(const Handle& other) const { return !(*this == other); }
+};
+
+// Maps stable handles to indices in a dense array (slot map).
+// Owners keep their data packed in [0, Count()) and mirror the swap-with-last moves done by RemoveAt().
+// Freed slots go on an intrusive free list, so after warm-up nothing allocates.
+class SlotMap
+{
+public:
+    size_t Count() const { return denseToSlot.size(); }
+    size_t Capacity() const { return slots.size(); }
+
+    void Reserve(size_t capacity)
+    {
+        slots.reserve(capacity);
+        denseToSlot.reserve(capacity);
+    }
+
+    // Reserves a slot for a new element appended at dense index Count()
+    Handle Add()
+    {
+        uint32_t slot;
+        if (freeHead != UINT32_MAX)
+        {
+            slot = freeHead;
+            freeHead = slots[slot].dense;
+        }
+        else
+        {
+            slot = (uint32_t)slots.size();
+            slots.push_back({ 0, 0 });
+        }
+
+        slots[slot].dense = (uint32_t)denseToSlot.size();
+        denseToSlot.push_back(slot);
+        return { slot, slots[slot].generation };
+    }
+
+    // Frees the element at dense index. The last element is moved into its place,
+    // so the owner must do the same with its own arrays.
+    void RemoveAt(size_t dense)
+    {
+        uint32_t slot = denseToSlot[dense];
+        uint32_t last = denseToSlot.back();
+        denseToSlot[dense] = last;
+        slots[last].dense = (uint32_t)dense;
+        denseToSlot.pop_back();
+
+        slots[slot].generation++;
+        slots[slot].dense = freeHead;
+        freeHead = slot;
+    }
+
+    bool Valid(Handle handle) const
+    {
+        return handle.index < slots.size() && slots[handle.index].generation == handle.generation;
+    }
+
+    // Dense index of a live handle, or SIZE_MAX if it has been removed
+    size_t Find(Handle handle) const
+    {
+        return Valid(handle) ? slots[handle.index].dense : SIZE_MAX;
+    }
+
+    // Dense index for a slot that is known to be live (ie ids stored in a SpatialGrid)
+    size_t DenseIndex(uint32_t slot) const { return slots[slot].dense; }
+
+    Handle HandleAt(size_t dense) const
+    {
+        uint32_t slot = denseToSlot[dense];
+        return { slot, slots[slot].generation };
+    }
+
+    // Current handle for a slot that is known to be live
+    Handle SlotHandle(uint32_t slot) const { return { slot, slots[slot].generation }; }
+
+    void Clear()
+    {
+        for (uint32_t slot : denseToSlot)
+        {
+            slots[slot].generation++;
+            slots[slot].dense = freeHead;
+            freeHead = slot;
+        }
+        denseToSlot.clear();
+    }
+
+private:
+    struct Slot
+    {
+        uint32_t dense;         // index into the dense array, or next free slot when unused
+        uint32_t generation;
+    };
+
+    std::vector<Slot> slots;
+    std::vector<uint32_t> denseToSlot;
+    uint32_t freeHead = UINT32_MAX;
+};
+
+// Densely packed objects addressed by generation-counted handles.
+// Iterate with a range-for or [0, Count()); order changes whenever something is removed.
+template<typename T>
+class Pool
+{
+public:
+    size_t Count() const { return items.size(); }
+    bool Empty() const { return items.empty(); }
+
+    void Reserve(size_t capacity)
+    {
+        map.Reserve(capacity);
+        items.reserve(capacity);
+    }
+
+    Handle Add(const T& item)
+    {
+        Handle handle = map.Add();
+        items.push_back(item);
+        return handle;
+    }
+
+    bool Remove(Handle handle)
+    {
+        size_t dense = map.Find(handle);
+        if (dense == SIZE_MAX)
+            return false;
+
+        RemoveAt(dense);
+        return true;
+    }
+
+    void RemoveAt(size_t dense)
+    {
+        map.RemoveAt(dense);
+        items[dense] = items.back();
+        items.pop_back();
+    }
+
+    // Removes every object matching pred, O(n) with no reallocation
+    template<typename Pred>
+    void RemoveIf(Pred&& pred)
+    {
+        for (size_t i = items.size(); i-- > 0;)
+        {
+            if (pred(items[i]))
+                RemoveAt(i);
+        }
+    }
+
+    void Clear()
+    {
+        map.Clear();
+        items.clear();
+    }
+
+    // nullptr if the object has been removed
+    T* Get(Handle handle)
+    {
+        size_t dense = map.Find(handle);
+        return dense == SIZE_MAX ? nullptr : &items[dense];
+    }
+
+    const T* Get(Handle handle) const
+    {
+        size_t dense = map.Find(handle);
+        return dense == SIZE_MAX ? nullptr : &items[dense];
+    }
+
+    bool Valid(Handle handle) const { return map.Valid(handle); }
+    Handle HandleAt(size_t dense) const { return map.HandleAt(dense); }
+    Handle SlotHandle(uint32_t slot) const { return map.SlotHandle(slot); }
+
+    // Lookup by slot for ids that are known to be live
+    T& AtSlot(uint32_t slot) { return items[map.DenseIndex(slot)]; }
+    const T& AtSlot(uint32_t slot) const { return items[map.DenseIndex(slot)]; }
+
+    T& operator[](size_t dense) { return items[dense]; }
+    const T& operator[](size_t dense) const { return items[dense]; }
+
+    typename std::vector<T>::iterator begin() { return items.begin(); }
+    typename std::vector<T>::iterator end() { return items.end(); }
+    typename std::vector<T>::const_iterator begin() const { return items.begin(); }
+    typename std::vector<T>::const_iterator end() const { return items.end(); }
+
+private:
+    SlotMap map;
+    std::vector<T> items;
+};
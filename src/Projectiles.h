@@ -0,0 +1,197 @@
+#pragma once
+#include <raylib.h>
+#include "Math.h"
+#include "Pool.h"
+
+#include <vector>
+#include <cstdint>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define PROJECTILE_SIMD_WIDTH 8
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define PROJECTILE_SIMD_WIDTH 4
+#else
+#define PROJECTILE_SIMD_WIDTH 1
+#endif
+
+enum ProjectileType : int
+{
+    BULLET,
+    MISSILE,
+    GRENADE,
+    PROJECTILE_TYPE_COUNT
+};
+
+struct ProjectileInfo
+{
+    float speed;
+    float radius;
+    float lifetime;
+    Color color;
+};
+
+constexpr ProjectileInfo PROJECTILES[PROJECTILE_TYPE_COUNT]
+{
+    //  speed   radius  lifetime  color
+    { 500.0f, 15.0f, 1.0f, BLUE },      // BULLET
+    { 800.0f, 35.0f, 1.0f, YELLOW },    // MISSILE
+    { 300.0f, 40.0f, 1.0f, MAROON },    // GRENADE
+};
+
+// Structure-of-arrays storage for every live projectile regardless of type.
+// Velocities are premultiplied by the type's speed and "time" counts down the remaining lifetime,
+// so integration and expiry are one branch-free pass with no per-type lookups.
+// Removal is swap-with-last, so indices are only stable until the next RemoveExpired(),
+// hold on to a Handle to refer to a projectile across frames.
+struct ProjectilePool
+{
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> dx;
+    std::vector<float> dy;
+    std::vector<float> time;
+    std::vector<ProjectileType> type;
+
+    std::vector<uint32_t> expired;              // 1 bit per projectile, set by Integrate() and Kill()
+    SlotMap handles;
+    size_t counts[PROJECTILE_TYPE_COUNT]{};     // live projectiles per type
+
+    size_t Count() const { return x.size(); }
+
+    void Reserve(size_t capacity)
+    {
+        x.reserve(capacity);
+        y.reserve(capacity);
+        dx.reserve(capacity);
+        dy.reserve(capacity);
+        time.reserve(capacity);
+        type.reserve(capacity);
+        expired.reserve(capacity / 32 + 1);
+        handles.Reserve(capacity);
+    }
+
+    // direction is expected to be normalized
+    Handle Spawn(ProjectileType projectileType, Vector2 position, Vector2 direction)
+    {
+        const ProjectileInfo& info = PROJECTILES[projectileType];
+        size_t i = x.size();
+        Handle handle = handles.Add();
+        x.push_back(position.x);
+        y.push_back(position.y);
+        dx.push_back(direction.x * info.speed);
+        dy.push_back(direction.y * info.speed);
+        time.push_back(info.lifetime);
+        type.push_back(projectileType);
+        counts[projectileType]++;
+
+        if (i / 32 >= expired.size())
+            expired.push_back(0);
+        expired[i / 32] &= ~(1u << (i % 32));
+        return handle;
+    }
+
+    Vector2 Position(size_t i) const { return { x[i], y[i] }; }
+    float Radius(size_t i) const { return PROJECTILES[type[i]].radius; }
+    bool Expired(size_t i) const { return (expired[i / 32] >> (i % 32)) & 1u; }
+
+    Handle HandleAt(size_t i) const { return handles.HandleAt(i); }
+    size_t Find(Handle handle) const { return handles.Find(handle); }   // SIZE_MAX once removed
+    size_t DenseIndex(uint32_t slot) const { return handles.DenseIndex(slot); }  // slot known to be live
+
+    // Flags a projectile for removal (ie on collision)
+    void Kill(size_t i) { expired[i / 32] |= 1u << (i % 32); }
+
+    // position += velocity * dt, time -= dt, flag everything whose time ran out.
+    void Integrate(float dt)
+    {
+        size_t count = x.size();
+        size_t i = 0;
+
+#if PROJECTILE_SIMD_WIDTH == 8
+        const __m256 step = _mm256_set1_ps(dt);
+        const __m256 zero = _mm256_setzero_ps();
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256 px = _mm256_loadu_ps(&x[i]);
+            __m256 py = _mm256_loadu_ps(&y[i]);
+            __m256 t = _mm256_sub_ps(_mm256_loadu_ps(&time[i]), step);
+            px = _mm256_add_ps(px, _mm256_mul_ps(_mm256_loadu_ps(&dx[i]), step));
+            py = _mm256_add_ps(py, _mm256_mul_ps(_mm256_loadu_ps(&dy[i]), step));
+            _mm256_storeu_ps(&x[i], px);
+            _mm256_storeu_ps(&y[i], py);
+            _mm256_storeu_ps(&time[i], t);
+
+            uint32_t mask = (uint32_t)_mm256_movemask_ps(_mm256_cmp_ps(t, zero, _CMP_LE_OQ));
+            expired[i / 32] |= mask << (i % 32);
+        }
+#elif PROJECTILE_SIMD_WIDTH == 4
+        const __m128 step = _mm_set1_ps(dt);
+        const __m128 zero = _mm_setzero_ps();
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 px = _mm_loadu_ps(&x[i]);
+            __m128 py = _mm_loadu_ps(&y[i]);
+            __m128 t = _mm_sub_ps(_mm_loadu_ps(&time[i]), step);
+            px = _mm_add_ps(px, _mm_mul_ps(_mm_loadu_ps(&dx[i]), step));
+            py = _mm_add_ps(py, _mm_mul_ps(_mm_loadu_ps(&dy[i]), step));
+            _mm_storeu_ps(&x[i], px);
+            _mm_storeu_ps(&y[i], py);
+            _mm_storeu_ps(&time[i], t);
+
+            uint32_t mask = (uint32_t)_mm_movemask_ps(_mm_cmple_ps(t, zero));
+            expired[i / 32] |= mask << (i % 32);
+        }
+#endif
+
+        // Scalar remainder (or everything when there's no SIMD)
+        for (; i < count; i++)
+        {
+            x[i] += dx[i] * dt;
+            y[i] += dy[i] * dt;
+            time[i] -= dt;
+            if (time[i] <= 0.0f)
+                Kill(i);
+        }
+    }
+
+    // Swap-removes every flagged projectile. Walks backwards so the element moved into a hole
+    // has always been visited already.
+    void RemoveExpired()
+    {
+        for (size_t word = expired.size(); word-- > 0;)
+        {
+            uint32_t bits = expired[word];
+            expired[word] = 0;
+            for (int bit = 31; bits != 0 && bit >= 0; bit--)
+            {
+                if ((bits >> bit) & 1u)
+                {
+                    bits &= ~(1u << bit);
+                    RemoveAt(word * 32 + bit);
+                }
+            }
+        }
+    }
+
+private:
+    void RemoveAt(size_t i)
+    {
+        size_t last = x.size() - 1;
+        counts[type[i]]--;
+        handles.RemoveAt(i);
+        x[i] = x[last];
+        y[i] = y[last];
+        dx[i] = dx[last];
+        dy[i] = dy[last];
+        time[i] = time[last];
+        type[i] = type[last];
+        x.pop_back();
+        y.pop_back();
+        dx.pop_back();
+        dy.pop_back();
+        time.pop_back();
+        type.pop_back();
+    }
+};
@@ -0,0 +1,229 @@
+#include "Simulation.h"
+
+#include <cfloat>
+#include <cmath>
+
+static const int MAP[TILE_COUNT][TILE_COUNT]
+{
+    //col:0  1  2  3  4  5  6  7  8  9 10 11 12 13 14 15 16 17 18 19    row:
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0 }, // 0
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0 }, // 1
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0 }, // 2
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0 }, // 3
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0 }, // 4
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0 }, // 5
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0 }, // 6
+        { 0, 0, 0, 2, 1, 1, 1, 1, 1, 1, 1, 1, 2, 0, 0, 0, 0, 0, 0, 0 }, // 7
+        { 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // 8
+        { 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // 9
+        { 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // 10
+        { 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // 11
+        { 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // 12
+        { 0, 0, 0, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 0, 0, 0 }, // 13
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0 }, // 14
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0 }, // 15
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0 }, // 16
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 1, 1, 1, 1, 1, 2, 0, 0, 0 }, // 17
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // 18
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }  // 19
+};
+
+// Records position as the event's position if it's the first since the events were reset or it's
+// closer to the listener than the one kept so far. count is the event's count including this one.
+static void KeepClosest(Vector2& kept, int count, Vector2 position, Vector2 listener)
+{
+    if (count == 1 || DistanceSqr(position, listener) < DistanceSqr(kept, listener))
+        kept = position;
+}
+
+// Same test as raylib's CheckCollisionCircles/CheckCollisionPointCircle, kept here so the simulation
+// doesn't need to link against raylib.
+static bool CirclesOverlap(Vector2 center1, float radius1, Vector2 center2, float radius2)
+{
+    float radii = radius1 + radius2;
+    return DistanceSqr(center1, center2) <= radii * radii;
+}
+
+Simulation::Simulation()
+{
+    tiles.Load(&MAP[0][0]);
+    projectiles.Reserve(1024);
+    enemies.Reserve(256);
+}
+
+void Simulation::Step(float dt)
+{
+    // Routing, built once and then only repaired around the tiles that changed
+    auto walkable = [this](int row, int col) { return Walkable(tiles.Get(row, col)); };
+    if (!flowField.Built())
+        flowField.Build(goal, walkable);
+    else if (!changedTiles.empty())
+        flowField.Repair(changedTiles, walkable);
+    changedTiles.clear();
+
+    // Spawning
+    for (int type = 0; type < ENEMY_TYPE_COUNT; type++)
+    {
+        spawnTimers[type] += dt;
+        if (spawnCounts[type] < spawnLimit && spawnTimers[type] >= ENEMIES[type].spawnInterval && flowField.Reachable(spawn))
+        {
+            spawnTimers[type] = 0.0f;
+            spawnCounts[type]++;
+
+            Enemy enemy;
+            enemy.type = (EnemyType)type;
+            enemy.hp = ENEMIES[type].hp;
+            enemy.position = TileCenter(spawn.row, spawn.col);
+            enemy.next = spawn;
+            enemies.Add(enemy);
+        }
+    }
+
+    // Flow field following
+    // Enemies walk from tile center to tile center, asking the field for the next tile each time they
+    // arrive. Large steps carry over into the following tiles so corners are never cut.
+    for (Enemy& enemy : enemies)
+    {
+        float step = ENEMIES[enemy.type].speed * dt;
+        for (;;)
+        {
+            Vector2 target = TileCenter(enemy.next.row, enemy.next.col);
+            float remaining = Distance(enemy.position, target);
+            if (step < remaining)
+            {
+                enemy.position = MoveTowards(enemy.position, target, step);
+                break;
+            }
+
+            // Stays put at the goal, or if a tile change cut it off
+            enemy.position = target;
+            step -= remaining;
+            Cell next = flowField.Next(enemy.next);
+            if (next.row == enemy.next.row && next.col == enemy.next.col)
+                break;
+            enemy.next = next;
+        }
+
+        int steps = flowField.Distance(enemy.next);
+        enemy.distance = steps == FlowField::UNREACHABLE ? FLT_MAX :
+            steps * TILE_SIZE + Distance(enemy.position, TileCenter(enemy.next.row, enemy.next.col));
+    }
+
+    // Broad-phase update, only touches the grid when an enemy crosses into new tiles
+    for (size_t i = 0; i < enemies.Count(); i++)
+        enemyGrid.Update(enemies.HandleAt(i).index, enemies[i].position, ENEMIES[enemies[i].type].radius);
+
+    // Targeting & shooting, turrets only look for a new target when they're ready to fire
+    for (Turret& turret : turrets)
+    {
+        turret.cooldown -= dt;
+        if (turret.cooldown > 0.0f)
+            continue;
+
+        turret.target = AcquireTarget(turret, enemies, enemyGrid);
+        const Enemy* target = enemies.Get(turret.target);
+        if (target == nullptr)
+        {
+            turret.cooldown = TURRET_RESCAN_INTERVAL;
+            continue;
+        }
+
+        turret.cooldown += turret.fireInterval;
+        if (turret.cooldown < 0.0f)
+            turret.cooldown = 0.0f;
+        projectiles.Spawn(turret.weapon, turret.position, Normalize(target->position - turret.position));
+        events.shots++;
+        KeepClosest(events.shotPosition, events.shots, turret.position, listener);
+    }
+
+    // Projectile update (movement & expiry for every type in one pass)
+    projectiles.Integrate(dt);
+
+    // Projectile collision, each projectile damages the first live enemy it overlaps
+    for (size_t i = 0; i < projectiles.Count(); i++)
+    {
+        if (projectiles.Expired(i))
+            continue;
+
+        Vector2 position = projectiles.Position(i);
+        float radius = projectiles.Radius(i);
+        Enemy* hit = nullptr;
+        enemyGrid.Query(position, radius, [&](int id) {
+            Enemy& enemy = enemies.AtSlot(id);
+            if (hit == nullptr && enemy.enabled && CirclesOverlap(enemy.position, ENEMIES[enemy.type].radius, position, radius))
+                hit = &enemy;
+        });
+
+        if (hit != nullptr)
+        {
+            projectiles.Kill(i);
+            hit->hp -= 1.0f;
+            events.hits++;
+            KeepClosest(events.hitPosition, events.hits, hit->position, listener);
+            if (hit->hp <= 0.0f)
+            {
+                hit->enabled = false;
+                events.deaths++;
+                KeepClosest(events.deathPosition, events.deaths, hit->position, listener);
+            }
+        }
+    }
+
+    // Projectile broad-phase, only read by the renderer to cull against the view. Most projectiles
+    // stay in the same tiles for several steps, so this mostly just compares bounds.
+    for (size_t i = 0; i < projectiles.Count(); i++)
+    {
+        if (projectiles.Expired(i))
+            projectileGrid.Remove(projectiles.HandleAt(i).index);
+        else
+            projectileGrid.Update(projectiles.HandleAt(i).index, projectiles.Position(i), projectiles.Radius(i));
+    }
+
+    // Projectile removal
+    projectiles.RemoveExpired();
+
+    // Enemy removal
+    for (size_t i = enemies.Count(); i-- > 0;)
+    {
+        if (!enemies[i].enabled)
+        {
+            enemyGrid.Remove(enemies.HandleAt(i).index);
+            enemies.RemoveAt(i);
+        }
+    }
+}
+
+bool Simulation::PlaceTurret(Vector2 position, ProjectileType weapon, TargetPolicy policy)
+{
+    Cell cell = { (int)floorf(position.y / TILE_SIZE), (int)floorf(position.x / TILE_SIZE) };
+    if (turrets.size() >= turretLimit || !tiles.InBounds(cell) || tiles.Get(cell.row, cell.col) != GRASS)
+        return false;
+
+    Turret turret;
+    turret.cell = cell;
+    turret.position = TileCenter(cell.row, cell.col);
+    turret.weapon = weapon;
+    turret.policy = policy;
+    turret.range = TURRETS[weapon].range;
+    turret.fireInterval = TURRETS[weapon].fireInterval;
+    turrets.push_back(turret);
+    tiles.Set(cell.row, cell.col, TURRET);
+    changedTiles.push_back(cell);
+    return true;
+}
+
+bool Simulation::RemoveTurret(Vector2 position)
+{
+    Cell cell = { (int)floorf(position.y / TILE_SIZE), (int)floorf(position.x / TILE_SIZE) };
+    for (size_t i = 0; i < turrets.size(); i++)
+    {
+        if (turrets[i].cell.row == cell.row && turrets[i].cell.col == cell.col)
+        {
+            tiles.Set(cell.row, cell.col, GRASS);
+            changedTiles.push_back(cell);
+            turrets.erase(turrets.begin() + i);
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include <raylib.h>
+#include "Math.h"
+#include "Tiles.h"
+#include "ChunkedTileMap.h"
+#include "FlowField.h"
+#include "Pool.h"
+#include "Enemies.h"
+#include "Turrets.h"
+#include "SpatialGrid.h"
+#include "Projectiles.h"
+
+#include <vector>
+
+// Fixed step used by both the game loop and the headless runner
+const float SIMULATION_DT = 1.0f / 60.0f;
+
+// Things that happened during Step() that the presentation layer may want to react to (ie play sounds).
+// Accumulates across steps until the caller resets it.
+struct SimulationEvents
+{
+    int shots = 0;
+    int hits = 0;
+    int deaths = 0;
+
+    // Where the one of each kind closest to Simulation::listener happened, only valid if its count > 0
+    Vector2 shotPosition{};
+    Vector2 hitPosition{};
+    Vector2 deathPosition{};
+};
+
+// All game state & rules, no window/audio/input dependencies so it can run headless.
+class Simulation
+{
+public:
+    Simulation();
+
+    // Advances the game by dt seconds
+    void Step(float dt);
+
+    // Returns false if the turret limit was reached or the tile under position can't be built on
+    bool PlaceTurret(Vector2 position, ProjectileType weapon = BULLET, TargetPolicy policy = FIRST);
+
+    // Removes the turret on the tile under position, returns false if there isn't one
+    bool RemoveTurret(Vector2 position);
+
+    ChunkedTileMap tiles{ TILE_COUNT, TILE_COUNT };
+    std::vector<Cell> changedTiles;     // since the flow field was last repaired
+
+    //routing info, the flow field is repaired during Step() after tiles changes
+    Cell spawn{ 0, 12 };
+    Cell goal{ 19, 9 };
+    FlowField flowField{ tiles.Rows(), tiles.Cols() };
+
+    //turret info
+    std::vector<Turret> turrets;
+    const float turretRadius = 20.0f;
+    size_t turretLimit = 6;
+
+    //enemy info (speed, radius, hp & spawn rate per type live in ENEMIES)
+    Pool<Enemy> enemies;
+    const int spawnLimit = 10;                      // per type
+    int spawnCounts[ENEMY_TYPE_COUNT]{};
+    float spawnTimers[ENEMY_TYPE_COUNT]{};
+
+    //projectile info (speed, radius & lifetime per type live in PROJECTILES)
+    ProjectilePool projectiles;
+
+    //collision info (broad-phase grid ids are enemy pool slots)
+    SpatialGrid enemyGrid{ tiles.Rows(), tiles.Cols(), TILE_SIZE };
+    SpatialGrid projectileGrid{ tiles.Rows(), tiles.Cols(), TILE_SIZE };   // ids are projectile slots, for view culling
+
+    SimulationEvents events;
+    Vector2 listener{};     // where the presentation layer hears events from, ie the camera's center
+};
@@ -0,0 +1,56 @@
+// Offline packer for LoadSoundBank(), decodes & resamples every sound once so the game doesn't at startup.
+//  soundbank <output.bank> <sample rate> <sound files...>
+// Sounds are named after their file without the extension, ie bullet.sound.mp3 -> "bullet.sound".
+// The sample rate has to match the game's audio device ("Sample rate" in the startup log), otherwise
+// the game ignores the bank and decodes the original files.
+#include <raylib.h>
+#include "raudio.c"
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    if (argc < 4)
+    {
+        printf("usage: soundbank <output.bank> <sample rate> <sound files...>\n");
+        return 1;
+    }
+
+    const char* output = argv[1];
+    int sampleRate = atoi(argv[2]);
+    if (sampleRate <= 0)
+    {
+        printf("invalid sample rate: %s\n", argv[2]);
+        return 1;
+    }
+
+    std::vector<Wave> waves;
+    std::vector<std::string> names;
+    for (int i = 3; i < argc; i++)
+    {
+        Wave wave = LoadWave(argv[i]);
+        if (wave.data == nullptr)
+        {
+            printf("failed to load %s\n", argv[i]);
+            for (Wave& loaded : waves)
+                UnloadWave(loaded);
+            return 1;
+        }
+        waves.push_back(wave);
+        names.push_back(GetFileNameWithoutExt(argv[i]));
+    }
+
+    std::vector<const char*> namePointers;
+    for (const std::string& name : names)
+        namePointers.push_back(name.c_str());
+
+    bool success = ExportSoundBank(waves.data(), namePointers.data(), (int)waves.size(), sampleRate, output);
+
+    for (Wave& wave : waves)
+        UnloadWave(wave);
+
+    return success ? 0 : 1;
+}
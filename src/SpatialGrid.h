@@ -0,0 +1,221 @@
+#pragma once
+#include <raylib.h>
+#include "Math.h"
+
+#include <vector>
+#include <memory>
+#include <algorithm>
+
+// Broad-phase uniform grid laid over the tile map.
+// Each circle is stored in every cell its bounding box overlaps. Circles remember which cells they
+// occupy, so moving one only touches the grid when it crosses into a different set of cells.
+// Cells are allocated a CHUNK_SIZE x CHUNK_SIZE chunk at a time, the first time something enters
+// the chunk, so a huge map only pays for the areas circles have actually been in.
+struct SpatialGrid
+{
+    static constexpr int CHUNK_SIZE = 32;
+
+    struct Chunk
+    {
+        std::vector<int> cells[CHUNK_SIZE * CHUNK_SIZE];    // ids per cell, row-major
+    };
+
+    struct Bounds
+    {
+        int rowMin = 0;
+        int colMin = 0;
+        int rowMax = -1;    // rowMax < rowMin means "not in the grid"
+        int colMax = -1;
+
+        bool Empty() const { return rowMax < rowMin; }
+        bool operator==(const Bounds& other) const
+        {
+            return rowMin == other.rowMin && colMin == other.colMin && rowMax == other.rowMax && colMax == other.colMax;
+        }
+    };
+
+    int rows = 0;
+    int cols = 0;
+    float cellSize = 0.0f;
+
+    int chunkCols = 0;
+    std::vector<std::unique_ptr<Chunk>> chunks;     // row-major, nullptr until first used
+    std::vector<Bounds> bounds;             // cells occupied per id
+
+    // Query de-duplication (a circle spanning several cells must only be reported once)
+    mutable std::vector<unsigned int> stamps;
+    mutable unsigned int stamp = 0;
+
+    SpatialGrid(int rows, int cols, float cellSize)
+        : rows(rows), cols(cols), cellSize(cellSize), chunkCols((cols + CHUNK_SIZE - 1) / CHUNK_SIZE),
+          chunks(((rows + CHUNK_SIZE - 1) / CHUNK_SIZE) * chunkCols)
+    {
+    }
+
+    Bounds CellBounds(Vector2 position, float radius) const
+    {
+        Bounds result;
+        result.colMin = (int)floorf((position.x - radius) / cellSize);
+        result.rowMin = (int)floorf((position.y - radius) / cellSize);
+        result.colMax = (int)floorf((position.x + radius) / cellSize);
+        result.rowMax = (int)floorf((position.y + radius) / cellSize);
+        return Clamped(result);
+    }
+
+    Bounds CellBounds(Rectangle area) const
+    {
+        Bounds result;
+        result.colMin = (int)floorf(area.x / cellSize);
+        result.rowMin = (int)floorf(area.y / cellSize);
+        result.colMax = (int)floorf((area.x + area.width) / cellSize);
+        result.rowMax = (int)floorf((area.y + area.height) / cellSize);
+        return Clamped(result);
+    }
+
+    // Clamps to the map, anything entirely outside of it occupies no cells
+    Bounds Clamped(Bounds result) const
+    {
+        if (result.colMax < 0 || result.rowMax < 0 || result.colMin >= cols || result.rowMin >= rows)
+            return Bounds{};
+
+        result.colMin = result.colMin < 0 ? 0 : result.colMin;
+        result.rowMin = result.rowMin < 0 ? 0 : result.rowMin;
+        result.colMax = result.colMax >= cols ? cols - 1 : result.colMax;
+        result.rowMax = result.rowMax >= rows ? rows - 1 : result.rowMax;
+        return result;
+    }
+
+    // Inserts or moves a circle. Cheap when the circle stays within the same cells.
+    void Update(int id, Vector2 position, float radius)
+    {
+        if (id >= (int)bounds.size())
+        {
+            bounds.resize(id + 1);
+            stamps.resize(id + 1, 0);
+        }
+
+        Bounds next = CellBounds(position, radius);
+        if (next == bounds[id])
+            return;
+
+        Unlink(id, bounds[id]);
+        Link(id, next);
+        bounds[id] = next;
+    }
+
+    void Remove(int id)
+    {
+        if (id >= (int)bounds.size())
+            return;
+
+        Unlink(id, bounds[id]);
+        bounds[id] = Bounds{};
+    }
+
+    void Clear()
+    {
+        for (std::unique_ptr<Chunk>& chunk : chunks)
+        {
+            if (!chunk)
+                continue;
+            for (std::vector<int>& cell : chunk->cells)
+                cell.clear();
+        }
+        bounds.clear();
+        stamps.clear();
+    }
+
+    // Calls fn(id) once for every circle sharing a cell with the query circle.
+    // Candidates still need a narrow-phase test (ie CheckCollisionCircles).
+    template<typename Fn>
+    void Query(Vector2 position, float radius, Fn&& fn) const
+    {
+        Query(CellBounds(position, radius), fn);
+    }
+
+    // Same for every circle sharing a cell with a rectangle, ie the camera's view
+    template<typename Fn>
+    void Query(Rectangle area, Fn&& fn) const
+    {
+        Query(CellBounds(area), fn);
+    }
+
+    template<typename Fn>
+    void Query(Bounds area, Fn&& fn) const
+    {
+        if (area.Empty())
+            return;
+
+        // Stamp wrapped around, forget every previous query
+        if (++stamp == 0)
+        {
+            std::fill(stamps.begin(), stamps.end(), 0);
+            stamp = 1;
+        }
+
+        for (int row = area.rowMin; row <= area.rowMax; row++)
+        {
+            for (int col = area.colMin; col <= area.colMax; col++)
+            {
+                const std::vector<int>* cell = Find(row, col);
+                if (cell == nullptr)
+                    continue;
+
+                for (int id : *cell)
+                {
+                    if (stamps[id] == stamp)
+                        continue;
+
+                    stamps[id] = stamp;
+                    fn(id);
+                }
+            }
+        }
+    }
+
+private:
+    // nullptr if nothing has ever been in the cell's chunk
+    const std::vector<int>* Find(int row, int col) const
+    {
+        const std::unique_ptr<Chunk>& chunk = chunks[(row / CHUNK_SIZE) * chunkCols + col / CHUNK_SIZE];
+        return chunk ? &chunk->cells[(row % CHUNK_SIZE) * CHUNK_SIZE + col % CHUNK_SIZE] : nullptr;
+    }
+
+    std::vector<int>& At(int row, int col)
+    {
+        std::unique_ptr<Chunk>& chunk = chunks[(row / CHUNK_SIZE) * chunkCols + col / CHUNK_SIZE];
+        if (!chunk)
+            chunk.reset(new Chunk());
+        return chunk->cells[(row % CHUNK_SIZE) * CHUNK_SIZE + col % CHUNK_SIZE];
+    }
+
+    void Link(int id, Bounds area)
+    {
+        for (int row = area.rowMin; row <= area.rowMax; row++)
+        {
+            for (int col = area.colMin; col <= area.colMax; col++)
+                At(row, col).push_back(id);
+        }
+    }
+
+    void Unlink(int id, Bounds area)
+    {
+        for (int row = area.rowMin; row <= area.rowMax; row++)
+        {
+            for (int col = area.colMin; col <= area.colMax; col++)
+            {
+                // Order within a cell doesn't matter so swap-remove
+                std::vector<int>& cell = At(row, col);
+                for (size_t i = 0; i < cell.size(); i++)
+                {
+                    if (cell[i] == id)
+                    {
+                        cell[i] = cell.back();
+                        cell.pop_back();
+                        break;
+                    }
+                }
+            }
+        }
+    }
+};
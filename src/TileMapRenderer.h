@@ -0,0 +1,176 @@
+#pragma once
+#include <raylib.h>
+#include "Math.h"
+#include "Tiles.h"
+#include "ChunkedTileMap.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+inline void DrawTile(int row, int col, Color color)
+{
+    DrawRectangle(col * TILE_SIZE, row * TILE_SIZE, TILE_SIZE, TILE_SIZE, color);
+}
+
+inline Color TileColor(int type)
+{
+    return type == GRASS || type == TURRET ? GREEN : BEIGE;
+}
+
+inline void DrawTile(int row, int col, int type)
+{
+    DrawTile(row, col, TileColor(type));
+}
+
+// Caches the tile map in world space, one render texture per visible chunk with a texel per tile, so a
+// frame costs a textured quad per chunk instead of a rectangle per tile. A chunk is only rasterized
+// again when its ChunkVersion() moves on; panning & zooming just draw the same textures with a
+// different camera (point filtered, so tiles stay sharp at any zoom). Uniform chunks skip the texture
+// and are drawn as one rectangle.
+// Textures of chunks that scrolled out of view are kept and handed to newly visible chunks, least
+// recently drawn first, so the cache never holds more than the most chunks ever on screen at once.
+// Needs a GL context, so Load() after InitWindow() and Unload() before CloseWindow().
+struct TileMapRenderer
+{
+    struct CachedChunk
+    {
+        RenderTexture2D target{};
+        int chunkRow = -1;
+        int chunkCol = -1;
+        unsigned int version = 0;   // chunk version the texture was rasterized at
+        unsigned int drawn = 0;     // frame the texture was last drawn
+        bool valid = false;
+    };
+
+    std::vector<CachedChunk> cache;
+    unsigned int frame = 0;
+
+    void Load()
+    {
+        cache.clear();
+        frame = 0;
+    }
+
+    void Unload()
+    {
+        for (CachedChunk& cached : cache)
+            UnloadRenderTexture(cached.target);
+        cache.clear();
+    }
+
+    // Call it outside of BeginMode2D(), chunks are rasterized first & then drawn with the camera
+    void Draw(const ChunkedTileMap& tiles, Camera2D camera)
+    {
+        frame++;
+
+        // Visible cells, inclusive
+        Rectangle view = VisibleArea(camera);
+        int rowMin = (int)floorf(view.y / TILE_SIZE);
+        int colMin = (int)floorf(view.x / TILE_SIZE);
+        int rowMax = (int)floorf((view.y + view.height) / TILE_SIZE);
+        int colMax = (int)floorf((view.x + view.width) / TILE_SIZE);
+
+        // Texture switches have to happen before the camera is set up, so bring every visible chunk up
+        // to date first
+        tiles.ForEachChunk(rowMin, colMin, rowMax, colMax, [&](int chunkRow, int chunkCol) {
+            if (tiles.Tiles(chunkRow, chunkCol) == nullptr)
+                return;
+
+            CachedChunk& cached = Acquire(chunkRow, chunkCol);
+            if (!cached.valid || cached.version != tiles.ChunkVersion(chunkRow, chunkCol))
+                Rasterize(tiles, cached);
+        });
+
+        const int SIZE = ChunkedTileMap::CHUNK_SIZE;
+        BeginMode2D(camera);
+        tiles.ForEachChunk(rowMin, colMin, rowMax, colMax, [&](int chunkRow, int chunkCol) {
+            int rows = std::min(SIZE, tiles.Rows() - chunkRow * SIZE);
+            int cols = std::min(SIZE, tiles.Cols() - chunkCol * SIZE);
+            Rectangle dest = { chunkCol * SIZE * TILE_SIZE, chunkRow * SIZE * TILE_SIZE, cols * TILE_SIZE, rows * TILE_SIZE };
+            if (tiles.Tiles(chunkRow, chunkCol) == nullptr)
+            {
+                DrawRectangleRec(dest, TileColor(tiles.UniformValue(chunkRow, chunkCol)));
+                return;
+            }
+
+            // Render textures are stored upside down (OpenGL), so flip the source rectangle. Tiles were
+            // drawn from the top, which for a partial edge chunk is the end of the texture.
+            const CachedChunk& cached = *Find(chunkRow, chunkCol);
+            Rectangle source = { 0.0f, (float)(SIZE - rows), (float)cols, -(float)rows };
+            DrawTexturePro(cached.target.texture, source, dest, { 0.0f, 0.0f }, 0.0f, WHITE);
+        });
+        EndMode2D();
+    }
+
+private:
+    CachedChunk* Find(int chunkRow, int chunkCol)
+    {
+        for (CachedChunk& cached : cache)
+        {
+            if (cached.chunkRow == chunkRow && cached.chunkCol == chunkCol)
+                return &cached;
+        }
+        return nullptr;
+    }
+
+    // The chunk's entry, else the least recently drawn one that isn't on screen this frame, else a new one
+    CachedChunk& Acquire(int chunkRow, int chunkCol)
+    {
+        CachedChunk* result = Find(chunkRow, chunkCol);
+        if (result == nullptr)
+        {
+            for (CachedChunk& cached : cache)
+            {
+                if (cached.drawn != frame && (result == nullptr || cached.drawn < result->drawn))
+                    result = &cached;
+            }
+        }
+
+        if (result == nullptr)
+        {
+            const int SIZE = ChunkedTileMap::CHUNK_SIZE;
+            cache.emplace_back();
+            result = &cache.back();
+            result->target = LoadRenderTexture(SIZE, SIZE);
+            SetTextureFilter(result->target.texture, TEXTURE_FILTER_POINT);
+        }
+
+        if (result->chunkRow != chunkRow || result->chunkCol != chunkCol)
+        {
+            result->chunkRow = chunkRow;
+            result->chunkCol = chunkCol;
+            result->valid = false;
+        }
+        result->drawn = frame;
+        return *result;
+    }
+
+    // One texel per tile, each run of same-type tiles in a row as one rectangle
+    void Rasterize(const ChunkedTileMap& tiles, CachedChunk& cached)
+    {
+        const int SIZE = ChunkedTileMap::CHUNK_SIZE;
+        const ChunkedTileMap::ChunkTiles& chunk = *tiles.Tiles(cached.chunkRow, cached.chunkCol);
+        int rows = std::min(SIZE, tiles.Rows() - cached.chunkRow * SIZE);
+        int cols = std::min(SIZE, tiles.Cols() - cached.chunkCol * SIZE);
+
+        BeginTextureMode(cached.target);
+        ClearBackground(BLACK);
+        for (int row = 0; row < rows; row++)
+        {
+            for (int col = 0; col < cols;)
+            {
+                int type = chunk.Get(row, col);
+                int end = col + 1;
+                while (end < cols && chunk.Get(row, end) == type)
+                    end++;
+                DrawRectangle(col, row, end - col, 1, TileColor(type));
+                col = end;
+            }
+        }
+        EndTextureMode();
+
+        cached.version = tiles.ChunkVersion(cached.chunkRow, cached.chunkCol);
+        cached.valid = true;
+    }
+};
@@ -0,0 +1,60 @@
+#pragma once
+#include <raylib.h>
+#include "Math.h"
+
+#include <array>
+
+const float SCREEN_SIZE = 800;
+
+const int TILE_COUNT = 20;
+const float TILE_SIZE = SCREEN_SIZE / TILE_COUNT;
+
+enum TileType : int
+{
+    GRASS,      // Marks unoccupied space, can be overwritten
+    DIRT,       // Marks the path, cannot be overwritten
+    WAYPOINT,   // Marks where the path turns, cannot be overwritten
+    TURRET,
+    COUNT
+};
+
+struct Cell
+{
+    int row;
+    int col;
+};
+
+constexpr std::array<Cell, 4> DIRECTIONS{ Cell{ -1, 0 }, Cell{ 1, 0 }, Cell{ 0, -1 }, Cell{ 0, 1 } };
+
+// Tiles enemies can walk on
+inline bool Walkable(int tile)
+{
+    return tile == DIRT || tile == WAYPOINT;
+}
+
+inline bool InBounds(Cell cell, int rows = TILE_COUNT, int cols = TILE_COUNT)
+{
+    return cell.col >= 0 && cell.col < cols && cell.row >= 0 && cell.row < rows;
+}
+
+inline Vector2 TileCenter(int row, int col)
+{
+    float x = col * TILE_SIZE + TILE_SIZE * 0.5f;
+    float y = row * TILE_SIZE + TILE_SIZE * 0.5f;
+    return { x, y };
+}
+
+inline Vector2 TileCorner(int row, int col)
+{
+    float x = col * TILE_SIZE;
+    float y = row * TILE_SIZE;
+    return { x, y };
+}
+
+// The part of the world a camera shows on a width x height screen, ignores camera.rotation
+inline Rectangle VisibleArea(Camera2D camera, float width = SCREEN_SIZE, float height = SCREEN_SIZE)
+{
+    float x = camera.target.x - camera.offset.x / camera.zoom;
+    float y = camera.target.y - camera.offset.y / camera.zoom;
+    return { x, y, width / camera.zoom, height / camera.zoom };
+}
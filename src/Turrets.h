@@ -0,0 +1,93 @@
+#pragma once
+#include <raylib.h>
+#include "Math.h"
+#include "Tiles.h"
+#include "Pool.h"
+#include "Enemies.h"
+#include "Projectiles.h"
+#include "SpatialGrid.h"
+
+enum TargetPolicy : int
+{
+    FIRST,      // closest to the goal
+    NEAREST,
+    STRONGEST,  // most hp left
+    TARGET_POLICY_COUNT
+};
+
+struct TurretInfo
+{
+    float range;
+    float fireInterval;     // seconds between shots
+};
+
+// Indexed by the turret's weapon
+constexpr TurretInfo TURRETS[PROJECTILE_TYPE_COUNT]
+{
+    //  range   fire interval
+    { 250.0f, 0.25f },      // BULLET
+    { 350.0f, 0.5f },       // MISSILE
+    { 200.0f, 0.75f },      // GRENADE
+};
+
+// How long an idle turret waits before scanning for targets again
+const float TURRET_RESCAN_INTERVAL = 0.1f;
+
+struct Turret
+{
+    Vector2 position{};
+    Cell cell{};
+    bool enabled = true;
+    TileType type = TURRET;
+
+    ProjectileType weapon = BULLET;
+    TargetPolicy policy = FIRST;
+    float range = 0.0f;
+    float fireInterval = 0.0f;
+    float cooldown = 0.0f;
+    Handle target{};    // stays safe to hold after the target despawns
+};
+
+// Picks the best enemy within range according to the turret's policy.
+// Only enemies in grid cells overlapping the range circle are considered.
+inline Handle AcquireTarget(const Turret& turret, const Pool<Enemy>& enemies, const SpatialGrid& grid)
+{
+    Handle best{};
+    float bestScore = 0.0f;
+    const float rangeSqr = turret.range * turret.range;
+
+    grid.Query(turret.position, turret.range, [&](int id) {
+        const Enemy& enemy = enemies.AtSlot(id);
+        float distanceSqr = DistanceSqr(turret.position, enemy.position);
+        if (!enemy.enabled || distanceSqr > rangeSqr)
+            return;
+
+        // Higher score wins
+        float score = 0.0f;
+        switch (turret.policy)
+        {
+        case FIRST:
+            score = -enemy.distance;
+            break;
+
+        case NEAREST:
+            score = -distanceSqr;
+            break;
+
+        case STRONGEST:
+            score = enemy.hp;
+            break;
+
+        default:
+            break;
+        }
+
+        if (best.index == UINT32_MAX || score > bestScore)
+        {
+            best = enemies.SlotHandle(id);
+            bestScore = score;
+        }
+    });
+
+    return best;
+}
@@ -0,0 +1,166 @@
+#pragma once
+#include <raylib.h>
+
+#include <vector>
+#include <cstdint>
+
+// Same default as raudio.c
+#ifndef MAX_AUDIO_BUFFER_POOL_CHANNELS
+#define MAX_AUDIO_BUFFER_POOL_CHANNELS 16
+#endif
+
+// Plays sound effects through a fixed set of preallocated aliases so overlapping triggers layer
+// instead of restarting one buffer, while the number of voices the mixer has to run stays bounded.
+//  - each sound gets maxVoices aliases up front, that's its polyphony limit
+//  - at most MAX_AUDIO_BUFFER_POOL_CHANNELS voices play at once across all sounds
+//  - when full, the lowest priority voice is stolen, then the furthest, then the oldest
+//  - a sound triggered more than once in the same frame only plays once
+// Call BeginFrame() once per frame before any Play().
+class VoicePool
+{
+public:
+    static const int MAX_VOICES = MAX_AUDIO_BUFFER_POOL_CHANNELS;
+
+    // Returns the id to Play() the sound with. The pool doesn't own source.
+    // A source that didn't load (ie a missing file) gets -1, so playing it does nothing.
+    int Add(Sound source, int maxVoices, int priority)
+    {
+        if (!IsSoundReady(source))
+            return -1;
+
+        SoundEntry entry;
+        entry.priority = priority;
+        entry.firstVoice = (int)voices.size();
+        entry.voiceCount = maxVoices;
+        sounds.push_back(entry);
+
+        for (int i = 0; i < maxVoices; i++)
+        {
+            Voice voice;
+            voice.alias = LoadSoundAlias(source);
+            voice.sound = (int)sounds.size() - 1;
+            voices.push_back(voice);
+        }
+        return (int)sounds.size() - 1;
+    }
+
+    void Unload()
+    {
+        for (Voice& voice : voices)
+            UnloadSoundAlias(voice.alias);
+        voices.clear();
+        sounds.clear();
+    }
+
+    void BeginFrame()
+    {
+        frame++;
+    }
+
+    // distance is from the listener, closer triggers win over further ones of the same priority.
+    // Returns false if the trigger was dropped (duplicate or nothing it's allowed to steal).
+    // Ids below 0 are ignored, so sounds that haven't loaded yet can be played without checks.
+    bool Play(int id, float distance = 0.0f)
+    {
+        if (id < 0)
+            return false;
+
+        SoundEntry& entry = sounds[id];
+        if (entry.frame == frame)
+            return false;
+
+        // Prefer an idle voice of this sound, otherwise steal its own furthest/oldest one
+        int chosen = -1;
+        for (int i = entry.firstVoice; i < entry.firstVoice + entry.voiceCount; i++)
+        {
+            if (!Busy(voices[i]))
+            {
+                chosen = i;
+                break;
+            }
+            if (chosen == -1 || Weaker(voices[i], voices[chosen]))
+                chosen = i;
+        }
+        if (chosen == -1)
+            return false;
+
+        bool stealing = Busy(voices[chosen]);
+        if (stealing && voices[chosen].distance < distance)
+            return false;
+
+        // Starting a new voice, make room under the global limit
+        if (!stealing && ActiveCount() >= MAX_VOICES)
+        {
+            int victim = -1;
+            for (int i = 0; i < (int)voices.size(); i++)
+            {
+                if (Busy(voices[i]) && (victim == -1 || Weaker(voices[i], voices[victim])))
+                    victim = i;
+            }
+
+            Voice candidate;
+            candidate.sound = id;
+            candidate.distance = distance;
+            candidate.frame = frame;
+            if (victim == -1 || !Weaker(voices[victim], candidate))
+                return false;
+
+            StopSound(voices[victim].alias);
+            voices[victim].frame = 0;
+        }
+
+        Voice& voice = voices[chosen];
+        voice.distance = distance;
+        voice.frame = frame;
+        PlaySound(voice.alias);
+        entry.frame = frame;
+        return true;
+    }
+
+    int ActiveCount() const
+    {
+        int count = 0;
+        for (const Voice& voice : voices)
+            count += Busy(voice) ? 1 : 0;
+        return count;
+    }
+
+private:
+    struct Voice
+    {
+        Sound alias{};
+        int sound = -1;
+        float distance = 0.0f;
+        uint32_t frame = 0;     // frame it was last started on, 0 = never/stopped
+    };
+
+    struct SoundEntry
+    {
+        int priority = 0;
+        int firstVoice = 0;     // voices of a sound are contiguous
+        int voiceCount = 0;
+        uint32_t frame = 0;     // frame it was last triggered on
+    };
+
+    // IsSoundPlaying() already counts a PlaySound()/StopSound() the mixer hasn't picked up yet
+    bool Busy(const Voice& voice) const
+    {
+        return voice.frame != 0 && IsSoundPlaying(voice.alias);
+    }
+
+    // True if a should be stolen before b
+    bool Weaker(const Voice& a, const Voice& b) const
+    {
+        int priorityA = sounds[a.sound].priority;
+        int priorityB = sounds[b.sound].priority;
+        if (priorityA != priorityB)
+            return priorityA < priorityB;
+        if (a.distance != b.distance)
+            return a.distance > b.distance;
+        return a.frame < b.frame;
+    }
+
+    std::vector<Voice> voices;
+    std::vector<SoundEntry> sounds;
+    uint32_t frame = 1;
+};